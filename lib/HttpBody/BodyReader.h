@@ -0,0 +1,15 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// A source of body bytes, read in pieces.
+class BodyReader
+{
+public:
+  virtual ~BodyReader() {}
+
+  // Reads up to len bytes. Returns how many, 0 at the end of the body, or -1
+  // if the body was cut short or timed out.
+  virtual int read(uint8_t *buf, size_t len) = 0;
+};
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "BodyReader.h"
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#else
+#include <chrono>
+#include <thread>
+#endif
+
+// Raw bytes from a network client (WiFiClient, WiFiClientSecure, or a fake in
+// the native tests) until the server closes the connection. Waits only while
+// the connection is open and nothing has arrived.
+template <typename TClient>
+class ClientReader : public BodyReader
+{
+public:
+  ClientReader(TClient &client, uint32_t timeoutMs)
+      : client_(client), timeoutMs_(timeoutMs)
+  {
+  }
+
+  int read(uint8_t *buf, size_t len) override
+  {
+    uint32_t start = nowMs();
+    while (true)
+    {
+      int avail = client_.available();
+      if (avail > 0)
+      {
+        int got = client_.read(buf, (size_t)avail < len ? (size_t)avail : len);
+        if (got > 0)
+          return got;
+      }
+      else if (!client_.connected())
+      {
+        return 0;
+      }
+      else if (nowMs() - start > timeoutMs_)
+      {
+        return -1;
+      }
+      else
+      {
+        waitMs(1);
+      }
+    }
+  }
+
+private:
+#ifdef ARDUINO
+  static uint32_t nowMs() { return millis(); }
+  static void waitMs(uint32_t ms) { delay(ms); }
+#else
+  static uint32_t nowMs()
+  {
+    return (uint32_t)std::chrono::duration_cast<std::chrono::milliseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+  }
+  static void waitMs(uint32_t ms) { std::this_thread::sleep_for(std::chrono::milliseconds(ms)); }
+#endif
+
+  TClient &client_;
+  uint32_t timeoutMs_;
+};
@@ -0,0 +1,267 @@
+#include "GzipStream.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#else
+#include <chrono>
+#endif
+
+// gzip member header flags (RFC 1952)
+#define GZIP_FHCRC 0x02
+#define GZIP_FEXTRA 0x04
+#define GZIP_FNAME 0x08
+#define GZIP_FCOMMENT 0x10
+
+static uint32_t clockMicros()
+{
+#ifdef ARDUINO
+  return micros();
+#else
+  return (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+#endif
+}
+
+static uint32_t updateCrc32(uint32_t crc, const uint8_t *buf, size_t len)
+{
+#if defined(ESP_PLATFORM)
+  return esp_rom_crc32_le(crc, buf, len);
+#else
+  return (uint32_t)mz_crc32(crc, buf, len);
+#endif
+}
+
+GzipStream::GzipStream(BodyReader &body, bool gzip)
+    : body_(body), gzip_(gzip)
+{
+}
+
+GzipStream::~GzipStream()
+{
+  free(inflator_);
+  free(window_);
+}
+
+bool GzipStream::begin()
+{
+  if (!gzip_)
+    return true;
+
+  inflator_ = (tinfl_decompressor *)malloc(sizeof(tinfl_decompressor));
+  window_ = (uint8_t *)malloc(TINFL_LZ_DICT_SIZE);
+  if (!inflator_ || !window_ || !parseHeader())
+  {
+    done_ = true;
+    failed_ = true;
+    return false;
+  }
+  tinfl_init(inflator_);
+  return true;
+}
+
+int GzipStream::read()
+{
+  if (outAvail_ == 0 && !fill())
+    return -1;
+  outAvail_--;
+  return *out_++;
+}
+
+bool GzipStream::finish()
+{
+  while (fill())
+    outAvail_ = 0;
+  return !failed_;
+}
+
+size_t GzipStream::readBytes(char *buf, size_t len)
+{
+  size_t n = 0;
+  while (n < len)
+  {
+    if (outAvail_ == 0 && !fill())
+      break;
+    size_t run = outAvail_ < len - n ? outAvail_ : len - n;
+    memcpy(buf + n, out_, run);
+    out_ += run;
+    outAvail_ -= run;
+    n += run;
+  }
+  return n;
+}
+
+// Makes the next run of output available. For gzip the run lives in the
+// window, so it must be fully consumed before the next one is inflated, since
+// tinfl may overwrite it with back references.
+bool GzipStream::fill()
+{
+  if (!gzip_)
+  {
+    if (done_)
+      return false;
+    int got = body_.read(inBuf_, kInBufSize);
+    if (got <= 0)
+    {
+      done_ = true;
+      failed_ = got < 0;
+      return false;
+    }
+    compressedBytes_ += got;
+    inflatedBytes_ += got;
+    out_ = inBuf_;
+    outAvail_ = got;
+    return true;
+  }
+
+  while (outAvail_ == 0 && !done_)
+  {
+    if (inPos_ == inLen_ && !inputEnded_)
+    {
+      fillInput();
+      if (done_)
+        break;
+    }
+
+    // Always says more input may follow: once the body ends, tinfl asking for
+    // more means it was cut short. Without the flag the ROM's older tinfl
+    // reads zeros past the end instead of failing.
+    size_t inBytes = inLen_ - inPos_;
+    size_t outBytes = TINFL_LZ_DICT_SIZE - windowOfs_;
+
+    uint32_t start = clockMicros();
+    tinfl_status status = tinfl_decompress(inflator_, inBuf_ + inPos_, &inBytes,
+                                           window_, window_ + windowOfs_, &outBytes,
+                                           TINFL_FLAG_HAS_MORE_INPUT);
+    inflateMicros_ += clockMicros() - start;
+
+    inPos_ += inBytes;
+    out_ = window_ + windowOfs_;
+    outAvail_ = outBytes;
+    windowOfs_ = (windowOfs_ + outBytes) & (TINFL_LZ_DICT_SIZE - 1);
+    inflatedBytes_ += outBytes;
+    crc_ = updateCrc32(crc_, out_, outBytes);
+
+    if (status == TINFL_STATUS_DONE)
+    {
+      done_ = true;
+      if (!checkTrailer())
+        failed_ = true;
+    }
+    else if (status < TINFL_STATUS_DONE || (status == TINFL_STATUS_NEEDS_MORE_INPUT && inputEnded_))
+    {
+      done_ = true;
+      failed_ = true;
+    }
+  }
+  return outAvail_ > 0;
+}
+
+// Reads the next piece of compressed body. A body that errors out (cut short
+// or timed out) fails the stream and ends it there.
+bool GzipStream::fillInput()
+{
+  inPos_ = 0;
+  inLen_ = 0;
+
+  int got = body_.read(inBuf_, kInBufSize);
+  if (got <= 0)
+  {
+    if (got < 0)
+    {
+      failed_ = true;
+      done_ = true;
+    }
+    inputEnded_ = true;
+    return false;
+  }
+  inLen_ = got;
+  compressedBytes_ += got;
+  return true;
+}
+
+int GzipStream::nextInputByte()
+{
+  if (inPos_ == inLen_ && (inputEnded_ || !fillInput()))
+    return -1;
+  return inBuf_[inPos_++];
+}
+
+bool GzipStream::skipInput(size_t count)
+{
+  while (count--)
+  {
+    if (nextInputByte() < 0)
+      return false;
+  }
+  return true;
+}
+
+bool GzipStream::skipZeroTerminated()
+{
+  int c;
+  while ((c = nextInputByte()) > 0)
+  {
+  }
+  return c == 0;
+}
+
+bool GzipStream::parseHeader()
+{
+  // ID1 ID2 CM FLG, then MTIME(4) XFL OS
+  if (nextInputByte() != 0x1f || nextInputByte() != 0x8b || nextInputByte() != 8)
+    return false;
+  int flg = nextInputByte();
+  if (flg < 0 || !skipInput(6))
+    return false;
+
+  if (flg & GZIP_FEXTRA)
+  {
+    int lo = nextInputByte();
+    int hi = nextInputByte();
+    if (lo < 0 || hi < 0 || !skipInput(lo | (hi << 8)))
+      return false;
+  }
+  if ((flg & GZIP_FNAME) && !skipZeroTerminated())
+    return false;
+  if ((flg & GZIP_FCOMMENT) && !skipZeroTerminated())
+    return false;
+  if ((flg & GZIP_FHCRC) && !skipInput(2))
+    return false;
+
+  return true;
+}
+
+// CRC32 and ISIZE (size mod 2^32), both little-endian, follow the deflate data.
+// tinfl may have read the first of them ahead into its bit buffer: miniz 2.x
+// and later hand back what they can, the ROM's 1.x keeps them all. Past the
+// last deflate byte's padding bits, those whole bytes come first.
+bool GzipStream::checkTrailer()
+{
+  mz_uint32 heldBits = inflator_->m_num_bits;
+  tinfl_bit_buf_t held = inflator_->m_bit_buf >> (heldBits & 7);
+  heldBits -= heldBits & 7;
+
+  uint32_t fields[2] = {0, 0};
+  for (int i = 0; i < 8; i++)
+  {
+    int c;
+    if (heldBits >= 8)
+    {
+      c = (int)(held & 0xff);
+      held >>= 8;
+      heldBits -= 8;
+    }
+    else
+    {
+      c = nextInputByte();
+    }
+    if (c < 0)
+      return false;
+    fields[i / 4] |= (uint32_t)c << (8 * (i % 4));
+  }
+  return fields[0] == crc_ && fields[1] == (uint32_t)inflatedBytes_;
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "BodyReader.h"
+
+#if defined(ESP_PLATFORM)
+#include <sdkconfig.h>
+#include <esp_rom_crc.h>
+#if CONFIG_IDF_TARGET_ESP32S3
+#include "esp32s3/rom/miniz.h"
+#else
+#include "esp32/rom/miniz.h"
+#endif
+#else
+// Host builds (native tests) use miniz 1.15, the release the ROM inflater
+// comes from, so its read-ahead and end-of-input behaviour is what gets tested.
+#define MINIZ_HEADER_FILE_ONLY
+#include <miniz.c>
+#endif
+
+// Inflates a gzip body on the fly with the miniz/tinfl inflater (in ROM on
+// the ESP32). Only a small input buffer and the deflate window are held, never
+// the whole body, and it reads like a stream, so it can be handed directly to
+// deserializeJson(). With gzip off it passes the body through unchanged, so
+// both kinds of response are read and counted the same way.
+class GzipStream
+{
+public:
+  GzipStream(BodyReader &body, bool gzip);
+  ~GzipStream();
+
+  // Allocates the window and checks the gzip header. False on either failure.
+  bool begin();
+
+  // True if the body was corrupt, cut short or timed out, or the gzip
+  // trailer's CRC32 or size did not match what was inflated.
+  bool failed() const { return failed_; }
+
+  // Reads whatever the parser left unread, so the trailer gets checked.
+  // Returns !failed().
+  bool finish();
+
+  bool gzip() const { return gzip_; }
+  // Body bytes as sent; the same as inflatedBytes() when not compressed.
+  size_t compressedBytes() const { return compressedBytes_; }
+  size_t inflatedBytes() const { return inflatedBytes_; }
+  uint32_t inflateMicros() const { return inflateMicros_; }
+
+  // The reader interface ArduinoJson expects.
+  int read();
+  size_t readBytes(char *buf, size_t len);
+
+private:
+  static const size_t kInBufSize = 512;
+
+  bool fill();
+  bool fillInput();
+  int nextInputByte();
+  bool skipInput(size_t count);
+  bool skipZeroTerminated();
+  bool parseHeader();
+  bool checkTrailer();
+
+  BodyReader &body_;
+  bool gzip_;
+
+  tinfl_decompressor *inflator_ = nullptr;
+  uint8_t *window_ = nullptr; // TINFL_LZ_DICT_SIZE, wraps around
+  size_t windowOfs_ = 0;
+
+  const uint8_t *out_ = nullptr;
+  size_t outAvail_ = 0;
+
+  uint8_t inBuf_[kInBufSize];
+  size_t inPos_ = 0;
+  size_t inLen_ = 0;
+  bool inputEnded_ = false;
+
+  bool done_ = false;
+  bool failed_ = false;
+
+  size_t compressedBytes_ = 0;
+  size_t inflatedBytes_ = 0;
+  uint32_t crc_ = 0;
+  uint32_t inflateMicros_ = 0;
+};
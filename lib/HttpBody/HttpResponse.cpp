@@ -0,0 +1,185 @@
+#include "HttpResponse.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+// Case-insensitive search for a token such as "gzip" in a header value.
+static bool hasToken(const char *value, const char *token)
+{
+  size_t len = strlen(token);
+  for (; *value; value++)
+  {
+    if (strncasecmp(value, token, len) == 0)
+      return true;
+  }
+  return false;
+}
+
+HttpResponse::HttpResponse(BodyReader &source)
+    : source_(source)
+{
+}
+
+bool HttpResponse::readHead()
+{
+  char line[kLineSize];
+
+  // "HTTP/1.1 200 OK"
+  if (readLine(line, sizeof(line)) < 0 || strncmp(line, "HTTP/", 5) != 0)
+    return false;
+  const char *code = strchr(line, ' ');
+  if (!code)
+    return false;
+  statusCode_ = atoi(code + 1);
+
+  int len;
+  while ((len = readLine(line, sizeof(line))) > 0)
+  {
+    char *colon = strchr(line, ':');
+    if (!colon)
+      continue;
+    *colon = '\0';
+    const char *value = colon + 1;
+    while (*value == ' ' || *value == '\t')
+      value++;
+
+    if (strcasecmp(line, "Content-Length") == 0)
+      contentLength_ = atol(value);
+    else if (strcasecmp(line, "Transfer-Encoding") == 0)
+      chunked_ = hasToken(value, "chunked");
+    else if (strcasecmp(line, "Content-Encoding") == 0)
+      gzip_ = hasToken(value, "gzip");
+  }
+  if (len < 0)
+    return false;
+
+  // A chunked body carries its own framing and ignores Content-Length.
+  remaining_ = chunked_ ? -1 : contentLength_;
+  return true;
+}
+
+int HttpResponse::read(uint8_t *buf, size_t len)
+{
+  if (bodyDone_)
+    return 0;
+
+  if (chunked_)
+  {
+    if (chunkLeft_ == 0 && !nextChunk())
+      return -1;
+    if (bodyDone_)
+      return 0;
+
+    int got = readBuffered(buf, len < chunkLeft_ ? len : chunkLeft_);
+    if (got <= 0)
+      return -1; // connection ended inside a chunk
+    chunkLeft_ -= got;
+    return got;
+  }
+
+  if (remaining_ == 0)
+  {
+    bodyDone_ = true;
+    return 0;
+  }
+
+  size_t want = len;
+  if (remaining_ > 0 && (size_t)remaining_ < want)
+    want = remaining_;
+
+  int got = readBuffered(buf, want);
+  if (got < 0)
+    return -1;
+  if (got == 0)
+  {
+    // Without a Content-Length the body ends when the server closes.
+    if (remaining_ > 0)
+      return -1;
+    bodyDone_ = true;
+    return 0;
+  }
+  if (remaining_ > 0)
+    remaining_ -= got;
+  return got;
+}
+
+int HttpResponse::nextByte()
+{
+  if (bufPos_ == bufLen_)
+  {
+    int got = source_.read(buf_, kBufSize);
+    if (got <= 0)
+      return -1;
+    bufPos_ = 0;
+    bufLen_ = got;
+  }
+  return buf_[bufPos_++];
+}
+
+// Reads one CRLF-terminated line, dropping whatever does not fit. Returns its
+// length, or -1 if the input ended first.
+int HttpResponse::readLine(char *line, size_t size)
+{
+  size_t len = 0;
+  int c;
+  while ((c = nextByte()) >= 0)
+  {
+    if (c == '\n')
+    {
+      if (len > 0 && line[len - 1] == '\r')
+        len--;
+      line[len] = '\0';
+      return (int)len;
+    }
+    if (len < size - 1)
+      line[len++] = (char)c;
+  }
+  return -1;
+}
+
+// Hands out bytes left over from header parsing before reading the source.
+int HttpResponse::readBuffered(uint8_t *buf, size_t len)
+{
+  if (bufPos_ < bufLen_)
+  {
+    size_t n = bufLen_ - bufPos_;
+    if (n > len)
+      n = len;
+    memcpy(buf, buf_ + bufPos_, n);
+    bufPos_ += n;
+    return (int)n;
+  }
+  return source_.read(buf, len);
+}
+
+// Reads the next chunk-size line of a chunked body. False on bad framing.
+bool HttpResponse::nextChunk()
+{
+  char line[kLineSize];
+
+  // Each chunk's data ends with its own CRLF.
+  if (!firstChunk_ && readLine(line, sizeof(line)) != 0)
+    return false;
+  firstChunk_ = false;
+
+  if (readLine(line, sizeof(line)) < 0)
+    return false;
+  char *end;
+  unsigned long size = strtoul(line, &end, 16);
+  if (end == line)
+    return false;
+
+  if (size == 0)
+  {
+    // Last chunk; skip any trailer fields up to the blank line.
+    while (readLine(line, sizeof(line)) > 0)
+    {
+    }
+    bodyDone_ = true;
+    return true;
+  }
+
+  chunkLeft_ = size;
+  return true;
+}
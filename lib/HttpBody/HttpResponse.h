@@ -0,0 +1,47 @@
+#pragma once
+
+#include "BodyReader.h"
+
+// An HTTP/1.1 response read off a raw connection. readHead() parses the
+// status line and the headers we care about; after that the object reads the
+// body, undoing chunked transfer encoding and stopping at Content-Length.
+class HttpResponse : public BodyReader
+{
+public:
+  explicit HttpResponse(BodyReader &source);
+
+  // False if the connection closed or timed out before the headers ended.
+  bool readHead();
+
+  int statusCode() const { return statusCode_; }
+  // -1 if the server did not send one.
+  long contentLength() const { return contentLength_; }
+  bool chunked() const { return chunked_; }
+  bool gzip() const { return gzip_; }
+
+  int read(uint8_t *buf, size_t len) override;
+
+private:
+  static const size_t kBufSize = 256;
+  static const size_t kLineSize = 128;
+
+  int nextByte();
+  int readLine(char *line, size_t size);
+  int readBuffered(uint8_t *buf, size_t len);
+  bool nextChunk();
+
+  BodyReader &source_;
+  uint8_t buf_[kBufSize];
+  size_t bufPos_ = 0;
+  size_t bufLen_ = 0;
+
+  int statusCode_ = 0;
+  long contentLength_ = -1;
+  bool chunked_ = false;
+  bool gzip_ = false;
+
+  long remaining_ = -1;   // body bytes left when Content-Length is known
+  size_t chunkLeft_ = 0;  // bytes left in the current chunk
+  bool firstChunk_ = true;
+  bool bodyDone_ = false;
+};
@@ -0,0 +1,56 @@
+#include "HttpUrl.h"
+
+#include <string.h>
+#include <strings.h>
+
+bool parseHttpUrl(const char *url, HttpUrl &out)
+{
+  const char *p;
+  if (strncasecmp(url, "https://", 8) == 0)
+  {
+    out.secure = true;
+    out.port = 443;
+    p = url + 8;
+  }
+  else if (strncasecmp(url, "http://", 7) == 0)
+  {
+    out.secure = false;
+    out.port = 80;
+    p = url + 7;
+  }
+  else
+  {
+    return false;
+  }
+
+  // host[:port] runs up to the path, query or fragment.
+  size_t authorityLen = strcspn(p, "/?#");
+  const char *colon = (const char *)memchr(p, ':', authorityLen);
+  size_t hostLen = colon ? (size_t)(colon - p) : authorityLen;
+  if (hostLen == 0 || hostLen >= HttpUrl::kHostSize || memchr(p, '@', authorityLen))
+    return false;
+  memcpy(out.host, p, hostLen);
+  out.host[hostLen] = '\0';
+
+  if (colon)
+  {
+    const char *digits = colon + 1;
+    size_t count = authorityLen - hostLen - 1;
+    if (count == 0 || count > 5)
+      return false;
+    long port = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+      if (digits[i] < '0' || digits[i] > '9')
+        return false;
+      port = port * 10 + (digits[i] - '0');
+    }
+    if (port < 1 || port > 65535)
+      return false;
+    out.port = (uint16_t)port;
+  }
+
+  out.targetStart = (p - url) + authorityLen;
+  out.targetEnd = out.targetStart + strcspn(url + out.targetStart, "#");
+  return true;
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// An http:// or https:// URL split into what it takes to connect and send the
+// request line.
+struct HttpUrl
+{
+  static const size_t kHostSize = 64;
+
+  bool secure;
+  char host[kHostSize];
+  uint16_t port; // from the URL, else 80 or 443
+
+  // Path and query as offsets into the parsed URL, without any fragment.
+  // Empty if the URL had neither.
+  size_t targetStart;
+  size_t targetEnd;
+};
+
+// False for any other scheme, a missing or overlong host, user info, or a port
+// that is not a number from 1 to 65535.
+bool parseHttpUrl(const char *url, HttpUrl &out);
@@ -0,0 +1,179 @@
+#include "TimeSync.h"
+
+#include <math.h>
+
+// Resync once the drift-corrected clock may be off by this much.
+static const int64_t kMaxErrorUs = 500000;
+
+// Drift uncertainty assumed until two syncs have measured the real crystal.
+static const double kDefaultUncertaintyPpm = 200.0;
+// Never trust the drift estimate more than this.
+static const double kMinUncertaintyPpm = 2.0;
+// One NTP reply over WiFi is good to roughly this much.
+static const double kSampleNoiseUs = 50000.0;
+// Anything beyond this is a clock step (e.g. RTC reset), not drift.
+static const double kMaxPlausibleDriftPpm = 5000.0;
+
+// Older samples stop counting beyond this, so the estimate can follow the
+// crystal as the temperature changes.
+static const double kMaxDriftWeightSec = 3 * 24 * 3600.0;
+
+// Shorter intervals are too noisy to estimate drift from.
+static const int64_t kMinDriftSampleSec = 30 * 60;
+static const int32_t kMinResyncSec = 15 * 60;
+static const int32_t kMaxResyncSec = 24 * 3600;
+
+static const int64_t kSyncTimeoutUs = 30 * 1000000LL;
+static const int64_t kRetryDelayUs = 60 * 1000000LL;
+
+TimeSync::TimeSync(SyncPlatform &platform, SyncState &state)
+    : platform_(platform), state_(state)
+{
+}
+
+SyncEvent TimeSync::update()
+{
+  int64_t timerUs = platform_.timerUs();
+
+  if (syncPending_)
+  {
+    NtpReply reply;
+    if (platform_.takeNtpReply(reply))
+    {
+      // We only need one answer; stop SNTP so it does not poll in the background.
+      platform_.stopNtp();
+      syncPending_ = false;
+      return applyReply(reply);
+    }
+    if (timerUs - syncStartUs_ > kSyncTimeoutUs)
+    {
+      platform_.stopNtp();
+      syncPending_ = false;
+      retryScheduled_ = true;
+      retryAtUs_ = timerUs + kRetryDelayUs;
+      return SYNC_TIMED_OUT;
+    }
+    return SYNC_NONE;
+  }
+
+  if (retryScheduled_ && timerUs < retryAtUs_)
+    return SYNC_NONE;
+
+  if (platform_.networkUp() && secondsUntilResync() <= 0)
+  {
+    platform_.startNtp();
+    syncPending_ = true;
+    retryScheduled_ = false;
+    syncStartUs_ = timerUs;
+    return SYNC_STARTED;
+  }
+  return SYNC_NONE;
+}
+
+void TimeSync::wokeFromSleep()
+{
+  if (state_.valid)
+    state_.sleptSinceSync = true;
+}
+
+// A clock behind the last sync was stepped back (e.g. an RTC reset to the
+// epoch) and cannot be corrected until the next sync.
+bool TimeSync::isSynced() const
+{
+  return state_.valid && platform_.clockUs() >= state_.lastSyncUs;
+}
+
+int64_t TimeSync::nowUs()
+{
+  if (!isSynced())
+    return 0;
+
+  int64_t clockUs = platform_.clockUs();
+  int64_t elapsedUs = clockUs - state_.lastSyncUs;
+  return clockUs + (int64_t)(elapsedUs * state_.driftPpm * 1e-6);
+}
+
+int32_t TimeSync::secondsUntilResync()
+{
+  if (!isSynced() || state_.sleptSinceSync)
+    return 0;
+
+  // Predicted error grows linearly with the uncertainty of the drift estimate.
+  double intervalSec = kMaxErrorUs / state_.uncertaintyPpm;
+  if (intervalSec < kMinResyncSec)
+    intervalSec = kMinResyncSec;
+  if (intervalSec > kMaxResyncSec)
+    intervalSec = kMaxResyncSec;
+
+  int64_t elapsedSec = (platform_.clockUs() - state_.lastSyncUs) / 1000000LL;
+  return (int32_t)((int64_t)intervalSec - elapsedSec);
+}
+
+SyncEvent TimeSync::applyReply(const NtpReply &reply)
+{
+  // Step the clock to the server time plus whatever passed since the reply.
+  platform_.setClockUs(reply.serverUs + (platform_.timerUs() - reply.timerUs));
+
+  SyncEvent event = SYNC_DONE;
+  lastOffsetUs_ = reply.serverUs - reply.clockUs;
+
+  if (!state_.valid)
+  {
+    state_.driftPpm = 0.0;
+    state_.uncertaintyPpm = kDefaultUncertaintyPpm;
+    state_.weightSec = 0.0;
+    state_.syncCount = 0;
+  }
+  else if (state_.sleptSinceSync)
+  {
+    // The offset is mostly the slow clock's error while asleep, not drift;
+    // just start a new interval from here.
+  }
+  else
+  {
+    // The clock ran free since the last sync set it, so the whole offset is drift.
+    int64_t intervalUs = reply.clockUs - state_.lastSyncUs;
+    if (intervalUs < 0 || intervalUs >= kMinDriftSampleSec * 1000000LL)
+    {
+      double measuredPpm = (double)lastOffsetUs_ / intervalUs * 1e6;
+      if (intervalUs < 0 || fabs(measuredPpm) > kMaxPlausibleDriftPpm)
+      {
+        state_.driftPpm = 0.0;
+        state_.uncertaintyPpm = kDefaultUncertaintyPpm;
+        state_.weightSec = 0.0;
+        state_.syncCount = 0;
+        event = SYNC_CLOCK_STEPPED;
+      }
+      else
+      {
+        // Weight each sample by its interval: a short one is mostly NTP noise
+        // and must not pull a long-established estimate far.
+        double sampleSec = intervalUs / 1e6;
+        double priorSec = state_.syncCount > 0 ? state_.weightSec : 0.0;
+        if (priorSec > kMaxDriftWeightSec)
+          priorSec = kMaxDriftWeightSec;
+        double totalSec = priorSec + sampleSec;
+
+        // How far the sample missed the prediction is the best evidence of
+        // how wrong the next prediction may be.
+        double missPpm = state_.syncCount > 0
+                             ? fabs(measuredPpm - state_.driftPpm)
+                             : kDefaultUncertaintyPpm / 2;
+        double priorUncertaintyPpm = state_.syncCount > 0 ? state_.uncertaintyPpm : 0.0;
+
+        state_.driftPpm = (state_.driftPpm * priorSec + measuredPpm * sampleSec) / totalSec;
+        state_.uncertaintyPpm = (priorUncertaintyPpm * priorSec + missPpm * sampleSec) / totalSec +
+                                kSampleNoiseUs / totalSec;
+        if (state_.uncertaintyPpm < kMinUncertaintyPpm)
+          state_.uncertaintyPpm = kMinUncertaintyPpm;
+        state_.weightSec = totalSec;
+        state_.syncCount++;
+      }
+    }
+  }
+
+  state_.lastSyncUs = reply.serverUs;
+  state_.sleptSinceSync = false;
+  state_.valid = true;
+  return event;
+}
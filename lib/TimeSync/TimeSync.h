@@ -0,0 +1,105 @@
+#pragma once
+
+#include <stdint.h>
+
+// One NTP answer: the server time and what the local clock and boot timer
+// read when it arrived.
+struct NtpReply
+{
+  int64_t serverUs;
+  int64_t clockUs;
+  int64_t timerUs;
+};
+
+// Hardware hooks for TimeSync. The watch implements them with SNTP, the
+// RTC-backed system clock and WiFi (src/TimeService.cpp); the native tests
+// use a simulated drifting clock and an NTP stand-in.
+class SyncPlatform
+{
+public:
+  virtual ~SyncPlatform() {}
+
+  // Wall clock in UTC microseconds. Keeps running across deep sleep.
+  virtual int64_t clockUs() = 0;
+  virtual void setClockUs(int64_t us) = 0;
+
+  // Monotonic microseconds since boot.
+  virtual int64_t timerUs() = 0;
+
+  virtual bool networkUp() = 0;
+  virtual void startNtp() = 0;
+  virtual void stopNtp() = 0;
+
+  // Hands over the NTP answer, if one arrived since startNtp().
+  virtual bool takeNtpReply(NtpReply &reply) = 0;
+};
+
+// Everything TimeSync needs to survive deep sleep. All zero means never synced.
+struct SyncState
+{
+  bool valid;
+  int64_t lastSyncUs; // epoch time of the last sync
+  double driftPpm;    // positive: local clock runs slow
+  double uncertaintyPpm;
+  double weightSec;   // sample time behind driftPpm
+  uint32_t syncCount; // drift samples behind driftPpm
+  bool sleptSinceSync;
+};
+
+enum SyncEvent
+{
+  SYNC_NONE,
+  SYNC_STARTED,
+  SYNC_DONE,
+  SYNC_CLOCK_STEPPED,
+  SYNC_TIMED_OUT
+};
+
+// Drift-compensated NTP time keeping.
+//
+// Each sync measures how far the local clock wandered since the previous one.
+// That drift is applied to every reading, and its uncertainty decides when the
+// corrected time may have drifted past the error threshold and needs a resync.
+// Only update() steps the clock, so a reading never mixes the new server time
+// with the correction for the old one.
+class TimeSync
+{
+public:
+  TimeSync(SyncPlatform &platform, SyncState &state);
+
+  // Starts, finishes or times out a sync. Call regularly.
+  SyncEvent update();
+
+  // Call once after waking from deep sleep. The clock ran on the RTC slow
+  // clock meanwhile, which is far less accurate than the crystal the drift
+  // was measured on, so a resync is due right away and the sleep is kept out
+  // of the drift estimate.
+  void wokeFromSleep();
+
+  // True once synced, until the clock is found stepped back behind the last
+  // sync; the next sync then corrects it.
+  bool isSynced() const;
+
+  // Drift-corrected UTC time, or 0 if never synced.
+  int64_t nowUs();
+
+  // Seconds until the next sync is due; 0 or less means due now.
+  int32_t secondsUntilResync();
+
+  // Local clock error found by the last sync.
+  int64_t lastOffsetUs() const { return lastOffsetUs_; }
+
+  const SyncState &state() const { return state_; }
+
+private:
+  SyncEvent applyReply(const NtpReply &reply);
+
+  SyncPlatform &platform_;
+  SyncState &state_;
+
+  bool syncPending_ = false;
+  int64_t syncStartUs_ = 0;
+  bool retryScheduled_ = false;
+  int64_t retryAtUs_ = 0;
+  int64_t lastOffsetUs_ = 0;
+};
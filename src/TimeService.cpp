@@ -0,0 +1,159 @@
+#include "TimeService.h"
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <sys/time.h>
+#include <esp_sntp.h>
+#include <esp_timer.h>
+#include <esp_attr.h>
+#include <esp_system.h>
+
+// Survives deep sleep; zeroed (never synced) on power-up.
+RTC_DATA_ATTR static SyncState rtcState;
+
+TimeService timeService;
+
+// Latest SNTP answer, written from the lwIP thread and taken in update().
+static portMUX_TYPE replyMux = portMUX_INITIALIZER_UNLOCKED;
+static bool replyArrived = false;
+static NtpReply pendingReply;
+
+static int64_t readClockUs()
+{
+  struct timeval tv;
+  gettimeofday(&tv, nullptr);
+  return (int64_t)tv.tv_sec * 1000000LL + tv.tv_usec;
+}
+
+// Replaces the weak ESP-IDF hook SNTP calls with each answer. The default one
+// steps the system clock right away, behind TimeSync's back; here the answer
+// is only recorded, and TimeSync steps the clock when it applies the sync.
+void sntp_sync_time(struct timeval *tv)
+{
+  NtpReply reply;
+  reply.serverUs = (int64_t)tv->tv_sec * 1000000LL + tv->tv_usec;
+  reply.clockUs = readClockUs();
+  reply.timerUs = esp_timer_get_time();
+
+  portENTER_CRITICAL(&replyMux);
+  pendingReply = reply;
+  replyArrived = true;
+  portEXIT_CRITICAL(&replyMux);
+
+  sntp_set_sync_status(SNTP_SYNC_STATUS_COMPLETED);
+}
+
+void EspSyncPlatform::setServer(const char *tz, const char *server)
+{
+  tz_ = tz;
+  server_ = server;
+}
+
+int64_t EspSyncPlatform::clockUs()
+{
+  return readClockUs();
+}
+
+void EspSyncPlatform::setClockUs(int64_t us)
+{
+  struct timeval tv;
+  tv.tv_sec = us / 1000000LL;
+  tv.tv_usec = us % 1000000LL;
+  settimeofday(&tv, nullptr);
+}
+
+int64_t EspSyncPlatform::timerUs()
+{
+  return esp_timer_get_time();
+}
+
+bool EspSyncPlatform::networkUp()
+{
+  return WiFi.status() == WL_CONNECTED;
+}
+
+void EspSyncPlatform::startNtp()
+{
+  portENTER_CRITICAL(&replyMux);
+  replyArrived = false;
+  portEXIT_CRITICAL(&replyMux);
+
+  sntp_set_sync_mode(SNTP_SYNC_MODE_IMMED);
+  configTzTime(tz_, server_);
+}
+
+void EspSyncPlatform::stopNtp()
+{
+  sntp_stop();
+}
+
+bool EspSyncPlatform::takeNtpReply(NtpReply &reply)
+{
+  portENTER_CRITICAL(&replyMux);
+  bool arrived = replyArrived;
+  if (arrived)
+    reply = pendingReply;
+  replyArrived = false;
+  portEXIT_CRITICAL(&replyMux);
+  return arrived;
+}
+
+TimeService::TimeService()
+    : sync_(platform_, rtcState)
+{
+}
+
+void TimeService::begin(const char *tz, const char *server)
+{
+  platform_.setServer(tz, server);
+
+  // The TZ rule lives in RAM only, so set it again after every boot or wake.
+  setenv("TZ", tz, 1);
+  tzset();
+
+  if (esp_reset_reason() == ESP_RST_DEEPSLEEP && sync_.isSynced())
+  {
+    sync_.wokeFromSleep();
+    Serial.printf("Woke from deep sleep, drift %.1f ppm, resyncing\n", sync_.state().driftPpm);
+  }
+}
+
+void TimeService::update()
+{
+  switch (sync_.update())
+  {
+  case SYNC_DONE:
+    Serial.printf("NTP sync: offset %lld ms, drift %.1f ppm (+/- %.1f), next sync in %ld s\n",
+                  (long long)(sync_.lastOffsetUs() / 1000), sync_.state().driftPpm,
+                  sync_.state().uncertaintyPpm, (long)sync_.secondsUntilResync());
+    break;
+  case SYNC_CLOCK_STEPPED:
+    Serial.println("Clock stepped, discarding drift estimate");
+    break;
+  case SYNC_TIMED_OUT:
+    Serial.println("NTP sync timed out");
+    break;
+  default:
+    break;
+  }
+}
+
+bool TimeService::isSynced() const
+{
+  return sync_.isSynced();
+}
+
+time_t TimeService::now()
+{
+  return (time_t)(sync_.nowUs() / 1000000LL);
+}
+
+bool TimeService::getLocalTime(struct tm *info)
+{
+  if (!sync_.isSynced())
+    return false;
+
+  time_t t = now();
+  localtime_r(&t, info);
+  return true;
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <time.h>
+#include <TimeSync.h>
+
+// TimeSync hooks on the ESP32: SNTP, the RTC-backed system clock and WiFi.
+class EspSyncPlatform : public SyncPlatform
+{
+public:
+  void setServer(const char *tz, const char *server);
+
+  int64_t clockUs() override;
+  void setClockUs(int64_t us) override;
+  int64_t timerUs() override;
+  bool networkUp() override;
+  void startNtp() override;
+  void stopNtp() override;
+  bool takeNtpReply(NtpReply &reply) override;
+
+private:
+  const char *tz_ = nullptr;
+  const char *server_ = nullptr;
+};
+
+// Background NTP time keeping for the watch.
+//
+// Syncs are started from update() whenever WiFi is up and a resync is due, so
+// nothing here ever blocks. Local time comes from a POSIX TZ rule (e.g.
+// "EST5EDT,M3.2.0,M11.1.0") instead of fixed offsets. The sync state is kept
+// in RTC memory and the system clock keeps running through deep sleep, but on
+// the much less accurate RTC slow clock, so after a wake the time is only
+// approximate until the resync that begin() schedules.
+class TimeService
+{
+public:
+  TimeService();
+
+  void begin(const char *tz, const char *server);
+
+  // Call regularly from loop(); starts and finishes background syncs.
+  void update();
+
+  // True once a sync has happened (in this boot or before a deep sleep).
+  bool isSynced() const;
+
+  // Drift-corrected UTC time, or 0 if never synced.
+  time_t now();
+
+  // Non-blocking replacement for getLocalTime(). Returns false until synced.
+  bool getLocalTime(struct tm *info);
+
+private:
+  EspSyncPlatform platform_;
+  TimeSync sync_;
+};
+
+extern TimeService timeService;
@@ -5,7 +5,13 @@
 #include <TFT_eSPI.h>
 #include <Wire.h> // touch
 #include <HTTPClient.h>
+#include <WiFiClientSecure.h>
 #include <ArduinoJson.h>
+#include "TimeService.h"
+#include <ClientReader.h>
+#include <HttpResponse.h>
+#include <GzipStream.h>
+#include <HttpUrl.h>
 
 // Pin defs (match User_Setup.h)
 #define TOUCH_SDA 6
@@ -16,8 +22,9 @@
 
 TFT_eSPI tft = TFT_eSPI();
 
-const long gmtOffset_sec = -5 * 3600;
-const int daylightOffset_sec = 3600;
+// US Eastern, DST from the second Sunday of March to the first Sunday of November
+const char *timeZone = "EST5EDT,M3.2.0,M11.1.0";
+const char *ntpServer = "pool.ntp.org";
 
 void setup()
 {
@@ -70,15 +77,93 @@ void setup()
   }
   Serial.println(" connected!");
 
-  // Set system time
-  configTime(gmtOffset_sec, daylightOffset_sec, "pool.ntp.org");
+  // Time syncs in the background from loop()
+  timeService.begin(timeZone, ntpServer);
+  timeService.update();
+}
 
-  struct tm timeinfo;
-  if (!getLocalTime(&timeinfo))
+// GET a Supabase REST url and parse the body straight off the socket.
+// Responses are requested gzip-compressed and inflated on the fly, so the
+// full body is never held in memory. Returns the HTTP code, or an
+// HTTPC_ERROR_* code (< 0) on transport errors; error is set if the body
+// did not parse. Only http:// and https:// URLs are supported.
+int getSupabaseJson(const String &url, JsonDocument &doc, DeserializationError &error)
+{
+  // HTTPClient adds its own "Accept-Encoding: identity" on HTTP/1.1, and
+  // nginx-style gateways do not gzip HTTP/1.0 replies by default, so the
+  // request is written by hand.
+  HttpUrl parts;
+  if (!parseHttpUrl(url.c_str(), parts))
   {
-    Serial.println("Failed to obtain time");
-    return;
+    Serial.println("Unsupported URL: " + url);
+    return HTTPC_ERROR_NOT_CONNECTED;
+  }
+  String target = url.substring(parts.targetStart, parts.targetEnd);
+  if (!target.startsWith("/"))
+  {
+    target = String("/") + target;
+  }
+  String host = parts.host;
+  if (parts.port != (parts.secure ? 443 : 80))
+  {
+    host += ':';
+    host += parts.port;
+  }
+
+  WiFiClient plainClient;
+  WiFiClientSecure secureClient;
+  secureClient.setInsecure(); // HTTPClient::begin(url) did not check the certificate either
+  WiFiClient &client = parts.secure ? secureClient : plainClient;
+  if (!client.connect(parts.host, parts.port))
+  {
+    return HTTPC_ERROR_CONNECTION_REFUSED;
+  }
+
+  client.print(String("GET ") + target + " HTTP/1.1\r\n" +
+               "Host: " + host + "\r\n" +
+               "apikey: " + SUPABASE_ANONKEY + "\r\n" +
+               "Authorization: Bearer " + SUPABASE_ANONKEY + "\r\n" +
+               "Accept-Encoding: gzip\r\n" +
+               "Connection: close\r\n\r\n");
+
+  ClientReader<WiFiClient> socket(client, HTTPCLIENT_DEFAULT_TCP_TIMEOUT);
+  HttpResponse response(socket);
+  if (!response.readHead())
+  {
+    client.stop();
+    return HTTPC_ERROR_READ_TIMEOUT;
+  }
+
+  GzipStream body(response, response.gzip());
+  if (body.begin())
+  {
+    error = deserializeJson(doc, body);
+  }
+  else
+  {
+    error = DeserializationError::InvalidInput;
+  }
+  // Drain the rest so the gzip trailer is checked. A body that was cut short
+  // or corrupt is an error even if what arrived happened to parse.
+  if (!body.finish() && !error)
+  {
+    error = DeserializationError::InvalidInput;
+  }
+
+  if (body.gzip())
+  {
+    Serial.printf("HTTP %d: %u bytes gzip -> %u bytes, inflate %lu us\n", response.statusCode(),
+                  (unsigned)body.compressedBytes(), (unsigned)body.inflatedBytes(),
+                  (unsigned long)body.inflateMicros());
+  }
+  else
+  {
+    Serial.printf("HTTP %d: %u bytes, not compressed\n", response.statusCode(),
+                  (unsigned)body.inflatedBytes());
   }
+
+  client.stop();
+  return response.statusCode();
 }
 
 String getUserFirstName(const char *user_id)
@@ -88,23 +173,12 @@ String getUserFirstName(const char *user_id)
   url += user_id;
   url += "&limit=1"; // Limit to the first matching row
 
-  HTTPClient http;
-  http.begin(url);
-  http.addHeader("apikey", SUPABASE_ANONKEY);
-  http.addHeader("Authorization", String("Bearer ") + SUPABASE_ANONKEY);
-
-  int httpCode = http.GET();
+  JsonDocument doc;
+  DeserializationError error;
+  int httpCode = getSupabaseJson(url, doc, error);
   String firstName = "";
   if (httpCode > 0)
   {
-    String payload = http.getString();
-    /*
-    Serial.println("Users payload:");
-    Serial.println(payload);
-    */
-
-    JsonDocument doc;
-    DeserializationError error = deserializeJson(doc, payload);
     if (!error)
     {
       if (doc.is<JsonArray>())
@@ -141,9 +215,8 @@ String getUserFirstName(const char *user_id)
   }
   else
   {
-    Serial.printf("HTTP GET error: %s\n", http.errorToString(httpCode).c_str());
+    Serial.printf("HTTP GET error: %s\n", HTTPClient::errorToString(httpCode).c_str());
   }
-  http.end();
   return firstName;
 }
 
@@ -247,30 +320,16 @@ bool getEventDetails(const JsonObject &eventData, String result[2])
   Serial.println(url);
   */
 
-  HTTPClient http;
-  http.begin(url);
-  http.addHeader("apikey", SUPABASE_ANONKEY);
-  http.addHeader("Authorization", String("Bearer ") + SUPABASE_ANONKEY);
-
-  int httpCode = http.GET();
+  // Expecting an array with one object.
+  JsonDocument doc;
+  DeserializationError err;
+  int httpCode = getSupabaseJson(url, doc, err);
   if (httpCode <= 0)
   {
-    Serial.printf("HTTP GET error: %s\n", http.errorToString(httpCode).c_str());
-    http.end();
+    Serial.printf("HTTP GET error: %s\n", HTTPClient::errorToString(httpCode).c_str());
     return false;
   }
 
-  String response = http.getString();
-  http.end();
-  /*
-  Serial.println("Response:");
-  Serial.println(response);
-  */
-
-  // Parse the JSON response.
-  // Expecting an array with one object.
-  JsonDocument doc;
-  DeserializationError err = deserializeJson(doc, response);
   if (err)
   {
     Serial.print("deserializeJson() failed: ");
@@ -313,33 +372,39 @@ int minutesUntilSlot(const struct tm &now, const String &slotKey)
 
 void loop()
 {
+  timeService.update();
+  if (!timeService.isSynced())
+  {
+    // Every countdown needs the time, so wait for the first sync.
+    // It can only start once WiFi is back.
+    tft.fillScreen(TFT_BLACK);
+    tft.setTextSize(2);
+    if (WiFi.status() == WL_CONNECTED)
+    {
+      tft.drawString("Syncing time...", 120, 120);
+    }
+    else
+    {
+      tft.drawString("WiFi disconnected", 120, 120);
+    }
+    delay(1000);
+    return;
+  }
+
   for (int i = 0; i < 5; i++)
   {
     Serial.println();
   }
   if (WiFi.status() == WL_CONNECTED)
   {
-    HTTPClient http;
-
     String url = SUPABASE_URL_BASE;
-    http.begin(url);
-
-    http.addHeader("apiKey", SUPABASE_ANONKEY);
-    http.addHeader("Authorization", "Bearer " + String(SUPABASE_ANONKEY));
 
-    int httpResponseCode = http.GET();
+    JsonDocument doc;
+    DeserializationError error;
+    int httpResponseCode = getSupabaseJson(url, doc, error);
 
     if (httpResponseCode > 0)
     {
-      String payload = http.getString();
-      /*
-      Serial.println("Supabase payload: ");
-      Serial.println(payload);
-      */
-
-      JsonDocument doc;
-      DeserializationError error = deserializeJson(doc, payload);
-
       if (!error)
       {
         if (doc.is<JsonArray>())
@@ -387,7 +452,7 @@ void loop()
                 //
                 struct tm timeinfo;
                 bool haveCurrentTime = false;
-                if (getLocalTime(&timeinfo))
+                if (timeService.getLocalTime(&timeinfo))
                 {
                   int hour12 = timeinfo.tm_hour % 12;
                   if (hour12 == 0)
@@ -594,11 +659,10 @@ void loop()
     else
     {
       Serial.print("HTTP GET error: ");
-      Serial.println(http.errorToString(httpResponseCode));
+      Serial.println(HTTPClient::errorToString(httpResponseCode));
       tft.fillScreen(TFT_BLACK);
       tft.drawString("HTTP error", 120, 120);
     }
-    http.end();
   }
   else
   {
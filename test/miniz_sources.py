@@ -0,0 +1,10 @@
+# miniz 1.15 ships as one miniz.c next to its examples and tinfl.c, which
+# would clash with it. Only build miniz.c.
+Import("env")
+
+
+def only_miniz_c(node):
+    return node if node.name == "miniz.c" else None
+
+
+env.AddBuildMiddleware(only_miniz_c, "*/libdeps/native/miniz/*")
@@ -0,0 +1,105 @@
+"""Writes payloads.h: Supabase responses and their gzip bodies for the tests.
+
+The JSON follows the rows the watch reads (plans with event_XXXX slots, users,
+ride details). Run from this directory: python make_payloads.py
+"""
+
+import gzip
+import io
+import json
+import struct
+import zlib
+
+SLOTS = ["1000", "1045", "1130", "1215", "1300", "1345", "1430", "1515",
+         "1600", "1645", "1730", "1815", "1900", "1945", "2030", "2115"]
+TYPES = ["Rides", "Shows", "Dining", "Shops", "Animals"]
+
+
+def plan_row(n):
+    row = {
+        "id": n + 1,
+        "created_at": "2025-04-%02dT14:%02d:07.118422+00:00" % (1 + n % 28, n % 60),
+        "user_id": "6f1c2a4e-%04x-4b7e-9d3a-0c5e8f2b%04x" % (n, n * 7),
+        "date": "2025-04-%02d" % (1 + n % 28),
+        "time_start": "10:00:00",
+        "time_end": "21:15:00",
+        "current_plan": n == 0,
+    }
+    for i, slot in enumerate(SLOTS):
+        row["event_" + slot] = {"id": (n * 16 + i) % 97 + 1, "type": TYPES[(n + i) % len(TYPES)]}
+    return row
+
+
+def dumps(value):
+    return json.dumps(value, separators=(",", ":")).encode()
+
+
+def plain_gzip(data):
+    return gzip.compress(data, compresslevel=9, mtime=0)
+
+
+def named_gzip(data, name):
+    out = io.BytesIO()
+    with gzip.GzipFile(filename=name, mode="wb", fileobj=out, mtime=0) as f:
+        f.write(data)
+    return out.getvalue()
+
+
+def gzip_all_fields(data):
+    """FEXTRA, FNAME, FCOMMENT and FHCRC all set."""
+    extra = b"AP\x04\x00test"
+    header = b"\x1f\x8b\x08\x1e" + struct.pack("<I", 0) + b"\x00\x03"
+    header += struct.pack("<H", len(extra)) + extra
+    header += b"event.json\x00" + b"recorded for the native tests\x00"
+    header += struct.pack("<H", zlib.crc32(header) & 0xFFFF)
+    deflate = zlib.compressobj(9, zlib.DEFLATED, -15)
+    body = deflate.compress(data) + deflate.flush()
+    trailer = struct.pack("<II", zlib.crc32(data), len(data) & 0xFFFFFFFF)
+    return header + body + trailer
+
+
+def c_array(name, data):
+    lines = ["static const uint8_t %s[] = {" % name]
+    for i in range(0, len(data), 16):
+        lines.append("    " + ", ".join("0x%02x" % b for b in data[i:i + 16]) + ",")
+    lines.append("};")
+    return "\n".join(lines)
+
+
+def c_string(name, data):
+    text = data.decode()
+    parts = [text[i:i + 80].replace("\\", "\\\\").replace('"', '\\"') for i in range(0, len(text), 80)]
+    return "static const char %s[] =\n" % name + "\n".join('    "%s"' % p for p in parts) + ";"
+
+
+def main():
+    plans = dumps([plan_row(n) for n in range(3)])
+    users = dumps([{"first_name": "Jimothy"}])
+    event = dumps([{"ride_name": "Iron Gwazi", "location": "Morocco"}])
+    plans_large = dumps([plan_row(n) for n in range(48)])
+    assert len(plans_large) > 32768
+
+    payloads = [
+        ("kPlans", plans, plain_gzip(plans)),
+        ("kUsers", users, plain_gzip(users)),
+        ("kEvent", event, gzip_all_fields(event)),
+        ("kPlansLarge", plans_large, named_gzip(plans_large, "plans.json")),
+    ]
+
+    out = ["// Generated by make_payloads.py; do not edit.", "#pragma once", "", "#include <stdint.h>", ""]
+    for name, raw, gz in payloads:
+        if name == "kPlansLarge":
+            # Too big to keep as text; the tests check its length and CRC32.
+            out.append("static const uint32_t %sJsonLength = %d;" % (name, len(raw)))
+            out.append("static const uint32_t %sJsonCrc = 0x%08x;" % (name, zlib.crc32(raw)))
+        else:
+            out.append(c_string(name + "Json", raw))
+        out.append("")
+        out.append(c_array(name + "Gz", gz))
+        out.append("")
+    with open("payloads.h", "w") as f:
+        f.write("\n".join(out))
+
+
+if __name__ == "__main__":
+    main()
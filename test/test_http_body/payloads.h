@@ -0,0 +1,334 @@
+// Generated by make_payloads.py; do not edit.
+#pragma once
+
+#include <stdint.h>
+
+static const char kPlansJson[] =
+    "[{\"id\":1,\"created_at\":\"2025-04-01T14:00:07.118422+00:00\",\"user_id\":\"6f1c2a4e-000"
+    "0-4b7e-9d3a-0c5e8f2b0000\",\"date\":\"2025-04-01\",\"time_start\":\"10:00:00\",\"time_end\""
+    ":\"21:15:00\",\"current_plan\":true,\"event_1000\":{\"id\":1,\"type\":\"Rides\"},\"event_1045"
+    "\":{\"id\":2,\"type\":\"Shows\"},\"event_1130\":{\"id\":3,\"type\":\"Dining\"},\"event_1215\":{\"i"
+    "d\":4,\"type\":\"Shops\"},\"event_1300\":{\"id\":5,\"type\":\"Animals\"},\"event_1345\":{\"id\":6"
+    ",\"type\":\"Rides\"},\"event_1430\":{\"id\":7,\"type\":\"Shows\"},\"event_1515\":{\"id\":8,\"type"
+    "\":\"Dining\"},\"event_1600\":{\"id\":9,\"type\":\"Shops\"},\"event_1645\":{\"id\":10,\"type\":\"A"
+    "nimals\"},\"event_1730\":{\"id\":11,\"type\":\"Rides\"},\"event_1815\":{\"id\":12,\"type\":\"Sho"
+    "ws\"},\"event_1900\":{\"id\":13,\"type\":\"Dining\"},\"event_1945\":{\"id\":14,\"type\":\"Shops\""
+    "},\"event_2030\":{\"id\":15,\"type\":\"Animals\"},\"event_2115\":{\"id\":16,\"type\":\"Rides\"}}"
+    ",{\"id\":2,\"created_at\":\"2025-04-02T14:01:07.118422+00:00\",\"user_id\":\"6f1c2a4e-000"
+    "1-4b7e-9d3a-0c5e8f2b0007\",\"date\":\"2025-04-02\",\"time_start\":\"10:00:00\",\"time_end\""
+    ":\"21:15:00\",\"current_plan\":false,\"event_1000\":{\"id\":17,\"type\":\"Shows\"},\"event_10"
+    "45\":{\"id\":18,\"type\":\"Dining\"},\"event_1130\":{\"id\":19,\"type\":\"Shops\"},\"event_1215\""
+    ":{\"id\":20,\"type\":\"Animals\"},\"event_1300\":{\"id\":21,\"type\":\"Rides\"},\"event_1345\":{"
+    "\"id\":22,\"type\":\"Shows\"},\"event_1430\":{\"id\":23,\"type\":\"Dining\"},\"event_1515\":{\"id"
+    "\":24,\"type\":\"Shops\"},\"event_1600\":{\"id\":25,\"type\":\"Animals\"},\"event_1645\":{\"id\":"
+    "26,\"type\":\"Rides\"},\"event_1730\":{\"id\":27,\"type\":\"Shows\"},\"event_1815\":{\"id\":28,\""
+    "type\":\"Dining\"},\"event_1900\":{\"id\":29,\"type\":\"Shops\"},\"event_1945\":{\"id\":30,\"typ"
+    "e\":\"Animals\"},\"event_2030\":{\"id\":31,\"type\":\"Rides\"},\"event_2115\":{\"id\":32,\"type\""
+    ":\"Shows\"}},{\"id\":3,\"created_at\":\"2025-04-03T14:02:07.118422+00:00\",\"user_id\":\"6f"
+    "1c2a4e-0002-4b7e-9d3a-0c5e8f2b000e\",\"date\":\"2025-04-03\",\"time_start\":\"10:00:00\","
+    "\"time_end\":\"21:15:00\",\"current_plan\":false,\"event_1000\":{\"id\":33,\"type\":\"Dining\""
+    "},\"event_1045\":{\"id\":34,\"type\":\"Shops\"},\"event_1130\":{\"id\":35,\"type\":\"Animals\"},"
+    "\"event_1215\":{\"id\":36,\"type\":\"Rides\"},\"event_1300\":{\"id\":37,\"type\":\"Shows\"},\"eve"
+    "nt_1345\":{\"id\":38,\"type\":\"Dining\"},\"event_1430\":{\"id\":39,\"type\":\"Shops\"},\"event_"
+    "1515\":{\"id\":40,\"type\":\"Animals\"},\"event_1600\":{\"id\":41,\"type\":\"Rides\"},\"event_16"
+    "45\":{\"id\":42,\"type\":\"Shows\"},\"event_1730\":{\"id\":43,\"type\":\"Dining\"},\"event_1815\""
+    ":{\"id\":44,\"type\":\"Shops\"},\"event_1900\":{\"id\":45,\"type\":\"Animals\"},\"event_1945\":{"
+    "\"id\":46,\"type\":\"Rides\"},\"event_2030\":{\"id\":47,\"type\":\"Shows\"},\"event_2115\":{\"id\""
+    ":48,\"type\":\"Dining\"}}]";
+
+static const uint8_t kPlansGz[] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xb5, 0x95, 0xd1, 0x4a, 0xc3, 0x40,
+    0x10, 0x45, 0xff, 0x65, 0x5f, 0x6d, 0x64, 0x67, 0x76, 0xd2, 0xb4, 0x79, 0x13, 0xfc, 0x02, 0xf5,
+    0x4d, 0xa4, 0xa4, 0xcd, 0x56, 0x03, 0x6d, 0x2c, 0x69, 0xaa, 0x88, 0xf4, 0xdf, 0x4d, 0x2a, 0xcd,
+    0x5e, 0x69, 0x66, 0x11, 0xc4, 0xbc, 0x65, 0x98, 0xcc, 0xde, 0x9d, 0x7b, 0x0f, 0x79, 0xfc, 0x34,
+    0x55, 0x69, 0x72, 0x9a, 0x98, 0x55, 0xe3, 0x8b, 0xd6, 0x97, 0x8b, 0xa2, 0x35, 0xb9, 0x61, 0xcb,
+    0x69, 0x62, 0x25, 0xb1, 0xf4, 0x40, 0x92, 0x5b, 0x9b, 0xdb, 0xec, 0x9a, 0x68, 0x26, 0xcc, 0x57,
+    0xfd, 0x8b, 0x35, 0x13, 0x73, 0xd8, 0xfb, 0x66, 0xd1, 0x7f, 0x6b, 0xa6, 0x6b, 0x5a, 0x71, 0x21,
+    0x3e, 0xb1, 0xdd, 0x93, 0xc8, 0x32, 0xf3, 0xc9, 0xbc, 0x74, 0x45, 0x62, 0x57, 0xa9, 0x9f, 0xad,
+    0x79, 0xd9, 0x97, 0xbb, 0x0f, 0xca, 0x6e, 0xfc, 0x8f, 0xd1, 0x5d, 0xad, 0xad, 0xb6, 0x7e, 0xb1,
+    0x6f, 0x8b, 0xa6, 0x3f, 0x94, 0x6c, 0x7e, 0x1e, 0x7e, 0xaa, 0xfb, 0xba, 0x9f, 0xce, 0x94, 0x53,
+    0xfa, 0x5d, 0x5d, 0x1d, 0x9a, 0xc6, 0xd7, 0xed, 0x62, 0xb7, 0x29, 0x6a, 0x93, 0xb7, 0xcd, 0xc1,
+    0x4f, 0x8c, 0x7f, 0xeb, 0x2b, 0xd4, 0x1f, 0x91, 0x0f, 0x77, 0x69, 0x3f, 0x76, 0xfd, 0x51, 0x77,
+    0x55, 0xe9, 0xf7, 0xe6, 0x18, 0x9a, 0x24, 0x3d, 0x37, 0xf1, 0xd0, 0x74, 0xff, 0xf2, 0xfa, 0x8e,
+    0x4d, 0xe4, 0x86, 0x49, 0x6e, 0x68, 0xba, 0xad, 0xea, 0xaa, 0x7e, 0x86, 0x2e, 0xa6, 0x61, 0x94,
+    0xe0, 0xa8, 0x1d, 0x8e, 0x72, 0x41, 0x54, 0x3a, 0x34, 0xdd, 0xd4, 0xd5, 0xb6, 0xd8, 0xfc, 0x68,
+    0x0b, 0xb2, 0xa6, 0xaa, 0x76, 0x09, 0xb2, 0x32, 0x55, 0x7b, 0x1a, 0x54, 0xcd, 0x74, 0xed, 0xd3,
+    0x20, 0x6b, 0xae, 0x6a, 0x9f, 0x06, 0x51, 0x64, 0x23, 0xe2, 0xb3, 0xa0, 0x8b, 0xf4, 0xcd, 0xcf,
+    0x82, 0x30, 0xd2, 0x57, 0x3f, 0x07, 0x13, 0x23, 0xbb, 0x9f, 0x83, 0x34, 0x75, 0xf9, 0x6c, 0x41,
+    0x58, 0x64, 0xfb, 0x4c, 0x20, 0xed, 0x62, 0xfd, 0xc7, 0xc9, 0x10, 0x97, 0x71, 0x3e, 0xf8, 0xc4,
+    0x07, 0xfd, 0x9a, 0x0f, 0x1a, 0xe7, 0x23, 0x1b, 0xe1, 0x83, 0xff, 0xc8, 0xc7, 0xba, 0xbb, 0xe7,
+    0x38, 0x20, 0x7a, 0x80, 0x80, 0x10, 0x8a, 0x24, 0x08, 0x18, 0x21, 0x3d, 0x42, 0xc0, 0x08, 0xc7,
+    0x22, 0x04, 0x98, 0xb0, 0x1e, 0x21, 0xa0, 0x84, 0xf5, 0x08, 0x01, 0x26, 0x1c, 0x89, 0x10, 0x80,
+    0xc2, 0x3a, 0xbf, 0x00, 0x0a, 0xc7, 0x00, 0x06, 0x56, 0x58, 0x27, 0x18, 0x48, 0x61, 0xdd, 0x01,
+    0x20, 0x85, 0x23, 0x0e, 0x00, 0x2a, 0xac, 0x3b, 0x00, 0xa4, 0xb8, 0x88, 0x03, 0xc8, 0x8a, 0x53,
+    0x1d, 0x40, 0x52, 0xdc, 0x85, 0x03, 0x67, 0x52, 0x9c, 0x46, 0x8a, 0x3b, 0x91, 0xc2, 0xbf, 0x26,
+    0x85, 0xc7, 0x49, 0xf1, 0x23, 0xa4, 0xb8, 0xff, 0x22, 0xc5, 0x45, 0x22, 0x04, 0xa8, 0x38, 0x3d,
+    0x42, 0xf8, 0x37, 0x89, 0x45, 0x08, 0x58, 0x71, 0x7a, 0x84, 0x80, 0x14, 0xa7, 0x47, 0x08, 0x48,
+    0x71, 0x91, 0x08, 0x01, 0x2a, 0x4e, 0x8f, 0x10, 0x90, 0x22, 0x31, 0x88, 0x81, 0x15, 0xd1, 0x21,
+    0x06, 0x52, 0x44, 0x87, 0x18, 0x48, 0x91, 0x88, 0x03, 0x80, 0x8a, 0xe8, 0x0e, 0x00, 0x29, 0x12,
+    0x73, 0x00, 0x58, 0x11, 0xd5, 0x01, 0x24, 0x45, 0x54, 0x07, 0x90, 0x14, 0xb9, 0x74, 0xe0, 0xf8,
+    0xf4, 0x05, 0xe3, 0xa2, 0x54, 0x79, 0x76, 0x09, 0x00, 0x00,
+};
+
+static const char kUsersJson[] =
+    "[{\"first_name\":\"Jimothy\"}]";
+
+static const uint8_t kUsersGz[] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x8b, 0xae, 0x56, 0x4a, 0xcb, 0x2c,
+    0x2a, 0x2e, 0x89, 0xcf, 0x4b, 0xcc, 0x4d, 0x55, 0xb2, 0x52, 0xf2, 0xca, 0xcc, 0xcd, 0x2f, 0xc9,
+    0xa8, 0x54, 0xaa, 0x8d, 0x05, 0x00, 0x46, 0x04, 0xa9, 0x66, 0x1a, 0x00, 0x00, 0x00,
+};
+
+static const char kEventJson[] =
+    "[{\"ride_name\":\"Iron Gwazi\",\"location\":\"Morocco\"}]";
+
+static const uint8_t kEventGz[] = {
+    0x1f, 0x8b, 0x08, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x08, 0x00, 0x41, 0x50, 0x04, 0x00,
+    0x74, 0x65, 0x73, 0x74, 0x65, 0x76, 0x65, 0x6e, 0x74, 0x2e, 0x6a, 0x73, 0x6f, 0x6e, 0x00, 0x72,
+    0x65, 0x63, 0x6f, 0x72, 0x64, 0x65, 0x64, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20,
+    0x6e, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x74, 0x65, 0x73, 0x74, 0x73, 0x00, 0xd9, 0xad, 0x8b,
+    0xae, 0x56, 0x2a, 0xca, 0x4c, 0x49, 0x8d, 0xcf, 0x4b, 0xcc, 0x4d, 0x55, 0xb2, 0x52, 0xf2, 0x2c,
+    0xca, 0xcf, 0x53, 0x70, 0x2f, 0x4f, 0xac, 0xca, 0x54, 0xd2, 0x51, 0xca, 0xc9, 0x4f, 0x4e, 0x2c,
+    0xc9, 0xcc, 0xcf, 0x03, 0x8a, 0xfb, 0xe6, 0x17, 0xe5, 0x27, 0x27, 0xe7, 0x2b, 0xd5, 0xc6, 0x02,
+    0x00, 0x5c, 0xa4, 0x8f, 0x8f, 0x31, 0x00, 0x00, 0x00,
+};
+
+static const uint32_t kPlansLargeJsonLength = 38875;
+static const uint32_t kPlansLargeJsonCrc = 0x7d498578;
+
+static const uint8_t kPlansLargeGz[] = {
+    0x1f, 0x8b, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0x70, 0x6c, 0x61, 0x6e, 0x73, 0x2e,
+    0x6a, 0x73, 0x6f, 0x6e, 0x00, 0xbd, 0xdd, 0xdb, 0x6a, 0x5c, 0xc9, 0x15, 0xc6, 0xf1, 0x77, 0xd1,
+    0x6d, 0xec, 0x50, 0xeb, 0x50, 0x27, 0xdd, 0x05, 0xf2, 0x04, 0x49, 0xee, 0x42, 0x30, 0x3a, 0xb4,
+    0x32, 0x86, 0x19, 0x67, 0xf0, 0x68, 0x12, 0x42, 0x98, 0x77, 0x8f, 0xb5, 0x83, 0xa5, 0x6a, 0x54,
+    0x6b, 0xf1, 0x87, 0xd0, 0x3d, 0x77, 0x16, 0xed, 0xf6, 0x76, 0xef, 0xfa, 0xf0, 0xfc, 0xf6, 0xea,
+    0xfa, 0xea, 0xaf, 0xff, 0xb9, 0xf9, 0xfc, 0x78, 0x73, 0x2b, 0x1f, 0x6e, 0x1e, 0xbe, 0x9e, 0xee,
+    0x9e, 0x4f, 0x8f, 0x9f, 0xee, 0x9e, 0x6f, 0x6e, 0x6f, 0xb4, 0x68, 0xfd, 0x58, 0xfc, 0x63, 0x91,
+    0xbf, 0x88, 0xdf, 0x96, 0x72, 0x5b, 0xfa, 0xef, 0x45, 0x86, 0xab, 0xfe, 0xee, 0xe5, 0x17, 0xe5,
+    0xe6, 0xc3, 0xcd, 0xaf, 0xbf, 0x9c, 0xbe, 0x7e, 0x7a, 0xf9, 0xbd, 0x37, 0xed, 0x49, 0x1e, 0xf4,
+    0xce, 0x4f, 0x1f, 0xcb, 0xb7, 0xff, 0x3e, 0xfa, 0x7d, 0x3f, 0x7d, 0x9c, 0x8f, 0x76, 0xf7, 0xb1,
+    0x3c, 0xd4, 0xd3, 0x78, 0xd2, 0xfb, 0x97, 0x1f, 0x7f, 0xfb, 0x0d, 0x8f, 0xdf, 0xde, 0xfe, 0xec,
+    0xad, 0xbf, 0xfd, 0xec, 0xf9, 0xf3, 0x4f, 0xa7, 0x4f, 0xbf, 0x3c, 0xdf, 0x7d, 0x7d, 0xf9, 0x43,
+    0xa5, 0xdc, 0x7e, 0x7f, 0xf3, 0xe3, 0xe7, 0xa7, 0x2f, 0x2f, 0xef, 0xae, 0x72, 0x2b, 0xf5, 0x7f,
+    0x3f, 0x7d, 0xf8, 0xf5, 0xeb, 0xd7, 0xd3, 0x97, 0xe7, 0x4f, 0x3f, 0xff, 0x78, 0xf7, 0xe5, 0xe6,
+    0xf6, 0xf9, 0xeb, 0xaf, 0xa7, 0x0f, 0x37, 0xa7, 0x7f, 0xbe, 0xfc, 0x44, 0x5e, 0xfe, 0x88, 0xdb,
+    0xd7, 0xbf, 0xcb, 0xf3, 0xbf, 0x7f, 0x7e, 0xf9, 0xa3, 0xfe, 0xf4, 0xf9, 0xf1, 0xf4, 0xcb, 0xcd,
+    0x6f, 0x6f, 0x2f, 0xf2, 0xfa, 0xfd, 0x45, 0xfa, 0xfa, 0xa2, 0x3f, 0xff, 0xf0, 0x8f, 0x7f, 0xad,
+    0x2f, 0x12, 0x7b, 0x7d, 0x27, 0x7b, 0x7d, 0xd1, 0x1f, 0x3f, 0x7f, 0xf9, 0xfc, 0xe5, 0xef, 0xcb,
+    0xab, 0x54, 0x5e, 0xdf, 0xca, 0xd7, 0xb7, 0xfa, 0x79, 0x7d, 0x2b, 0x7b, 0xbb, 0xa8, 0xfa, 0xfa,
+    0xa2, 0x3f, 0x7c, 0xf9, 0xfc, 0xd3, 0xdd, 0x8f, 0x67, 0x2f, 0x7b, 0xbb, 0xac, 0x16, 0x5e, 0xbb,
+    0xbf, 0x5d, 0x56, 0x0f, 0xaf, 0xbd, 0xbe, 0x5d, 0xd5, 0x88, 0xaf, 0xbd, 0xbd, 0x5d, 0xd6, 0x0c,
+    0xaf, 0xbd, 0xbd, 0x5d, 0x94, 0x94, 0xe4, 0xe2, 0xfb, 0xdb, 0x75, 0x49, 0xfc, 0xc9, 0x8f, 0xb7,
+    0x0b, 0x93, 0xf8, 0xa3, 0x9f, 0xcb, 0x4d, 0x4c, 0x3e, 0xfb, 0xb9, 0x5c, 0x5a, 0xf8, 0xe1, 0x6b,
+    0x59, 0x2e, 0x2c, 0xf9, 0xf4, 0x55, 0x96, 0x4b, 0x7b, 0xf7, 0xf1, 0xff, 0xf6, 0xe1, 0x75, 0xb9,
+    0xec, 0xf3, 0xa1, 0x47, 0x3e, 0x04, 0xe7, 0x43, 0xf6, 0xf9, 0xe8, 0x9b, 0x7c, 0xe8, 0xff, 0x99,
+    0x8f, 0xa7, 0x6f, 0x7f, 0xcf, 0x7d, 0x40, 0xe2, 0x05, 0xb4, 0x24, 0x44, 0x92, 0x15, 0xb4, 0x64,
+    0x44, 0xe2, 0x25, 0xb4, 0x64, 0x44, 0xb3, 0x25, 0xb4, 0xc4, 0x44, 0xe3, 0x25, 0xb4, 0xa4, 0x44,
+    0xe3, 0x25, 0xb4, 0xc4, 0x44, 0x93, 0x25, 0xb4, 0x04, 0x45, 0xe3, 0xfc, 0x2e, 0x41, 0xd1, 0x2c,
+    0xc0, 0x4b, 0x56, 0x34, 0x4e, 0xf0, 0x92, 0x14, 0x8d, 0xef, 0xc0, 0x92, 0x14, 0x4d, 0xee, 0xc0,
+    0x12, 0x15, 0x8d, 0xef, 0xc0, 0x92, 0x14, 0x4b, 0xee, 0xc0, 0x9a, 0x15, 0x0b, 0xef, 0xc0, 0x9a,
+    0x14, 0x7b, 0x77, 0x07, 0xbe, 0x27, 0xc5, 0xa2, 0xa4, 0xd8, 0x91, 0x14, 0xc5, 0x49, 0xd1, 0x7d,
+    0x52, 0x4e, 0x9b, 0xa4, 0xd8, 0xa5, 0x92, 0x62, 0xc9, 0x12, 0x5a, 0xa2, 0x62, 0xf1, 0x12, 0x5a,
+    0xff, 0x35, 0xc9, 0x96, 0xd0, 0x92, 0x15, 0x8b, 0x97, 0xd0, 0x92, 0x14, 0x8b, 0x97, 0xd0, 0x92,
+    0x14, 0x4b, 0x96, 0xd0, 0x12, 0x15, 0x8b, 0x97, 0xd0, 0x92, 0x14, 0xcf, 0x42, 0xbc, 0x64, 0xc5,
+    0xe3, 0x10, 0x2f, 0x49, 0xf1, 0x38, 0xc4, 0x4b, 0x52, 0x3c, 0xb9, 0x03, 0x4b, 0x54, 0x3c, 0xbe,
+    0x03, 0x4b, 0x52, 0x3c, 0xbb, 0x03, 0x4b, 0x56, 0x3c, 0xbc, 0x03, 0x6b, 0x52, 0x3c, 0xbc, 0x03,
+    0x6b, 0x52, 0xfc, 0xfd, 0x1d, 0xf8, 0x1e, 0x15, 0x8f, 0xa2, 0xe2, 0x47, 0x54, 0x0c, 0x47, 0xc5,
+    0xb6, 0x51, 0xf9, 0x76, 0x0d, 0xef, 0xa3, 0xe2, 0x97, 0x8a, 0x8a, 0xc7, 0x4b, 0x68, 0x49, 0x4a,
+    0xcd, 0x96, 0xd0, 0x92, 0x95, 0x1a, 0x2f, 0xa1, 0x25, 0x29, 0x35, 0x5e, 0x42, 0xeb, 0xff, 0x7a,
+    0x25, 0x4b, 0x68, 0x89, 0x4a, 0x8d, 0x97, 0xd0, 0x92, 0x94, 0x9a, 0x2d, 0xa1, 0x25, 0x2b, 0x35,
+    0x0e, 0xf1, 0x92, 0x94, 0x1a, 0x87, 0x78, 0x49, 0x4a, 0x4d, 0x42, 0xbc, 0x44, 0xa5, 0xc6, 0x77,
+    0x60, 0x49, 0x4a, 0xcb, 0xee, 0xc0, 0x92, 0x95, 0x16, 0xdf, 0x81, 0x25, 0x29, 0x2d, 0xbc, 0x03,
+    0x6b, 0x52, 0x5a, 0x7c, 0x07, 0xd6, 0xa8, 0xb4, 0x77, 0x77, 0xe0, 0x7b, 0x52, 0x6a, 0x94, 0x94,
+    0x7a, 0x24, 0xc5, 0x71, 0x52, 0x7c, 0x9f, 0x94, 0x87, 0x4d, 0x52, 0xea, 0xa5, 0x92, 0xd2, 0xb2,
+    0x25, 0xb4, 0x64, 0xa5, 0xc5, 0x4b, 0x68, 0x49, 0x4a, 0x8b, 0x97, 0xd0, 0x92, 0x94, 0x96, 0x2c,
+    0xa1, 0x25, 0x2a, 0x2d, 0x5e, 0x42, 0x4b, 0x52, 0x7a, 0xb6, 0x84, 0x56, 0xa7, 0xc4, 0x4b, 0x68,
+    0x49, 0x4a, 0x8f, 0x43, 0xbc, 0x24, 0xa5, 0x27, 0x21, 0x5e, 0xa2, 0xd2, 0xe3, 0x10, 0x2f, 0x49,
+    0xe9, 0xd9, 0x1d, 0x58, 0xb2, 0xd2, 0xe3, 0x3b, 0xb0, 0x24, 0xa5, 0xc7, 0x77, 0x60, 0x49, 0x4a,
+    0x8f, 0xef, 0xc0, 0x1a, 0x95, 0x1e, 0xde, 0x81, 0x35, 0x29, 0x63, 0x73, 0x07, 0xbe, 0x67, 0xa5,
+    0x45, 0x59, 0x69, 0x47, 0x56, 0x2a, 0xce, 0x4a, 0xdd, 0x66, 0x45, 0x6d, 0x93, 0x95, 0x76, 0xa9,
+    0xac, 0x0c, 0x84, 0xf9, 0x81, 0x34, 0x3f, 0x18, 0xe7, 0x07, 0xf2, 0xfc, 0x80, 0xa0, 0x1f, 0x48,
+    0xf4, 0x83, 0x91, 0x9e, 0x99, 0x7e, 0x20, 0xd4, 0x4f, 0x88, 0xfa, 0x89, 0x50, 0x3f, 0x11, 0xea,
+    0x27, 0x43, 0xfd, 0x44, 0xa8, 0x9f, 0x10, 0xf5, 0x33, 0x44, 0x7d, 0x8f, 0x92, 0xd2, 0x8f, 0xa4,
+    0x34, 0x9c, 0x94, 0xb6, 0x4f, 0xca, 0xdd, 0x26, 0x29, 0xfd, 0x52, 0x49, 0x99, 0x0c, 0xf5, 0xc8,
+    0xf4, 0x4a, 0x48, 0x6f, 0x4c, 0xf4, 0x4e, 0x40, 0x5f, 0x89, 0xe7, 0x1b, 0xe2, 0x7c, 0x27, 0x9a,
+    0x1f, 0x0c, 0xf3, 0x93, 0x58, 0x7e, 0x79, 0x3a, 0x96, 0x58, 0x5e, 0x04, 0x59, 0x5e, 0x94, 0x58,
+    0x5e, 0x8c, 0x59, 0x5e, 0x9c, 0x58, 0x5e, 0x6a, 0x64, 0xf9, 0x11, 0x05, 0x64, 0x1c, 0x01, 0xe9,
+    0x38, 0x20, 0x7d, 0x1b, 0x10, 0x93, 0x4d, 0x40, 0xc6, 0xc5, 0x9e, 0x7a, 0x35, 0x64, 0x79, 0xe9,
+    0xc4, 0xf2, 0x32, 0x98, 0xe5, 0x65, 0x12, 0xcb, 0x6b, 0x21, 0x96, 0x57, 0x41, 0x96, 0x57, 0x25,
+    0x96, 0x57, 0x63, 0x96, 0x57, 0x27, 0x96, 0xd7, 0x4a, 0x2c, 0xaf, 0x0d, 0x59, 0x5e, 0x3b, 0xb1,
+    0xbc, 0x0e, 0x66, 0x79, 0x9d, 0xc4, 0xf2, 0x56, 0x88, 0xe5, 0x4d, 0x42, 0xcb, 0xcf, 0x28, 0x2a,
+    0xf3, 0x88, 0xca, 0xc0, 0x51, 0x19, 0xfb, 0xa8, 0x8c, 0x4d, 0x54, 0xe6, 0xc5, 0x1e, 0x7b, 0x29,
+    0xb1, 0xbc, 0x19, 0xb3, 0xbc, 0x39, 0xb1, 0xbc, 0x55, 0x62, 0x79, 0x6b, 0xc8, 0xf2, 0xd6, 0x89,
+    0xe5, 0x6d, 0x30, 0xcb, 0xdb, 0x24, 0x96, 0xf7, 0x42, 0x2c, 0xef, 0x82, 0x2c, 0xef, 0x4a, 0x2c,
+    0xef, 0xc6, 0x2c, 0xef, 0x4e, 0x2c, 0xef, 0x95, 0x58, 0xde, 0x1b, 0xb2, 0xbc, 0xf7, 0xc8, 0xf2,
+    0x2f, 0xff, 0x5e, 0x6e, 0xa3, 0x22, 0xe5, 0x88, 0xca, 0xc4, 0x51, 0x99, 0xfb, 0xa8, 0x3c, 0xbd,
+    0x8f, 0x8a, 0x94, 0x8b, 0x3d, 0xf6, 0x1a, 0x0c, 0xf3, 0x3e, 0x09, 0xe6, 0x6b, 0x21, 0x98, 0xaf,
+    0x82, 0x30, 0x5f, 0x95, 0x60, 0xbe, 0x1a, 0xc3, 0x7c, 0x75, 0x82, 0xf9, 0x5a, 0x09, 0xe6, 0x6b,
+    0x43, 0x98, 0xaf, 0x9d, 0x60, 0xbe, 0x0e, 0x86, 0xf9, 0x3a, 0x09, 0xe6, 0x5b, 0x21, 0x98, 0x6f,
+    0x82, 0x30, 0xdf, 0x94, 0x60, 0xbe, 0x59, 0x8c, 0x79, 0x89, 0x06, 0xf3, 0x72, 0x0c, 0xe6, 0x85,
+    0x0f, 0xe6, 0xef, 0xb6, 0x61, 0xf1, 0xb6, 0x09, 0x8b, 0x5c, 0xec, 0xc9, 0x97, 0x13, 0xcd, 0xb7,
+    0x4a, 0x34, 0xdf, 0x1a, 0xd2, 0x7c, 0xeb, 0x44, 0xf3, 0x6d, 0xc0, 0xf1, 0xfc, 0x44, 0xf3, 0xf9,
+    0x42, 0x34, 0xdf, 0x05, 0x69, 0xbe, 0x2b, 0xd1, 0x7c, 0x37, 0xa6, 0xf9, 0xee, 0x44, 0xf3, 0xbd,
+    0x12, 0xcd, 0xf7, 0x86, 0x34, 0xdf, 0x3b, 0xd1, 0x7c, 0x1f, 0x4c, 0xf3, 0x7d, 0x46, 0x9a, 0x97,
+    0x68, 0x46, 0x2f, 0xc7, 0x8c, 0x5e, 0xf8, 0x8c, 0xfe, 0x7e, 0x1f, 0x95, 0xc7, 0x4d, 0x54, 0x2e,
+    0x36, 0xa3, 0x1f, 0x85, 0x70, 0x7e, 0x30, 0xcf, 0x0f, 0x04, 0xfa, 0x01, 0x45, 0x3f, 0x10, 0xe9,
+    0x07, 0x32, 0xfd, 0x60, 0xa8, 0x1f, 0x4c, 0xf5, 0x90, 0xf5, 0x03, 0xb9, 0x7e, 0x22, 0xd7, 0x4f,
+    0xe6, 0xfa, 0x89, 0x5c, 0x3f, 0xa1, 0xeb, 0x27, 0x72, 0xfd, 0x0c, 0x5d, 0x2f, 0xd1, 0x90, 0x5e,
+    0x8e, 0x21, 0xbd, 0xf0, 0x21, 0xfd, 0xc3, 0x36, 0x2a, 0xd5, 0x37, 0x51, 0xb9, 0xd8, 0x90, 0x7e,
+    0x32, 0xd8, 0x4f, 0x06, 0x7b, 0xe6, 0x7a, 0x45, 0x23, 0x7a, 0xa2, 0x7a, 0x47, 0xa8, 0xaf, 0xc4,
+    0xf4, 0x8d, 0x91, 0xbe, 0x13, 0xd1, 0x0f, 0x02, 0xfa, 0x89, 0x3c, 0x7f, 0xfe, 0x80, 0x2c, 0xf2,
+    0xbc, 0x08, 0xf3, 0xbc, 0x28, 0xf1, 0xbc, 0x18, 0xf1, 0xbc, 0x78, 0xe8, 0x79, 0x89, 0x86, 0xf3,
+    0x72, 0x0c, 0xe7, 0x85, 0x0f, 0xe7, 0x1f, 0xf7, 0x11, 0xb9, 0xdf, 0x44, 0xe4, 0x62, 0xc3, 0x79,
+    0xa9, 0x04, 0xf4, 0xd2, 0x18, 0xe8, 0xa5, 0x13, 0xd0, 0xcb, 0x20, 0xa0, 0x97, 0x89, 0x40, 0xaf,
+    0x85, 0x80, 0x5e, 0x85, 0x81, 0x5e, 0x95, 0x80, 0x5e, 0x8d, 0x80, 0x5e, 0x1d, 0x81, 0x5e, 0x2b,
+    0x01, 0xbd, 0x36, 0x06, 0x7a, 0xed, 0x04, 0xf4, 0x3a, 0x08, 0xe8, 0x75, 0x22, 0xd0, 0x5b, 0x09,
+    0x41, 0x1f, 0x4d, 0xe7, 0xe5, 0x98, 0xce, 0x0b, 0x9f, 0xce, 0x9f, 0xb6, 0x51, 0x69, 0xba, 0x89,
+    0xca, 0xc5, 0xa6, 0xf3, 0x26, 0x0c, 0xf4, 0xa6, 0x04, 0xf4, 0x66, 0x04, 0xf4, 0xe6, 0x08, 0xf4,
+    0x56, 0x09, 0xe8, 0xad, 0x31, 0xd0, 0x5b, 0x27, 0xa0, 0xb7, 0x41, 0x40, 0x6f, 0x13, 0x81, 0xde,
+    0x0b, 0x01, 0xbd, 0x0b, 0x03, 0xbd, 0x2b, 0x01, 0xbd, 0x1b, 0x01, 0xbd, 0x3b, 0x02, 0xbd, 0x57,
+    0x02, 0x7a, 0x6f, 0x09, 0xe8, 0xa3, 0xf1, 0xbc, 0x1c, 0xe3, 0x79, 0xe1, 0xe3, 0xf9, 0xa7, 0x7d,
+    0x58, 0xe6, 0x26, 0x2c, 0x17, 0x1b, 0xcf, 0x7b, 0x27, 0xa0, 0xf7, 0x41, 0x40, 0xef, 0x13, 0x81,
+    0xbe, 0x16, 0xf4, 0x75, 0x7b, 0x61, 0xa0, 0xaf, 0x4a, 0x40, 0x5f, 0x8d, 0x80, 0xbe, 0x3a, 0x02,
+    0x7d, 0xad, 0x04, 0xf4, 0xb5, 0x31, 0xd0, 0xd7, 0x4e, 0x40, 0x5f, 0x07, 0x01, 0x7d, 0x9d, 0x08,
+    0xf4, 0xad, 0x10, 0xd0, 0x37, 0x61, 0xa0, 0x6f, 0x1a, 0x82, 0x3e, 0x9a, 0xcf, 0xcb, 0x31, 0x9f,
+    0x17, 0x3c, 0x9f, 0x97, 0xfd, 0xa6, 0x94, 0xbe, 0xd9, 0x94, 0x22, 0x17, 0x9b, 0xcf, 0x37, 0x23,
+    0xa0, 0x6f, 0x8e, 0x40, 0xdf, 0x2a, 0x01, 0x7d, 0x6b, 0x0c, 0xf4, 0xad, 0x13, 0xd0, 0xb7, 0x81,
+    0x86, 0xf4, 0x93, 0x4d, 0xe9, 0x0b, 0x01, 0x7d, 0x17, 0x06, 0xfa, 0xae, 0x04, 0xf4, 0xdd, 0x08,
+    0xe8, 0xbb, 0x23, 0xd0, 0xf7, 0x4a, 0x40, 0xdf, 0x1b, 0x03, 0x7d, 0xef, 0x04, 0xf4, 0x7d, 0x84,
+    0xa0, 0x8f, 0x26, 0xf5, 0x72, 0x4c, 0xea, 0x05, 0x4f, 0xea, 0x65, 0xbf, 0x3f, 0xa5, 0x6f, 0xf6,
+    0xa7, 0xc8, 0xc5, 0x26, 0xf5, 0x7d, 0x22, 0xd0, 0x8f, 0x42, 0x40, 0x3f, 0xa0, 0xe8, 0x07, 0x22,
+    0xfd, 0x40, 0xa6, 0x1f, 0x0c, 0xf5, 0x03, 0xa9, 0x7e, 0x40, 0xd6, 0x0f, 0xe6, 0x7a, 0x04, 0xfb,
+    0xc1, 0x64, 0x3f, 0x91, 0xec, 0x27, 0x94, 0xfd, 0x44, 0xb2, 0x9f, 0x48, 0xf6, 0x33, 0x91, 0x7d,
+    0x34, 0xaa, 0x97, 0x63, 0x54, 0x2f, 0x78, 0x54, 0x2f, 0xfb, 0x1d, 0x2a, 0x7d, 0xb3, 0x43, 0x45,
+    0x2e, 0x36, 0xaa, 0x9f, 0x48, 0xf6, 0x13, 0xca, 0x7e, 0x32, 0xd9, 0x13, 0xd8, 0x2b, 0x1b, 0xd4,
+    0x13, 0xd6, 0x3b, 0xfc, 0xca, 0x3d, 0x41, 0x7d, 0x23, 0xa6, 0xef, 0x88, 0xf4, 0x83, 0x88, 0x7e,
+    0x32, 0xd0, 0x2f, 0xcf, 0xc8, 0x12, 0xd0, 0x8b, 0x10, 0xd0, 0x8b, 0x22, 0xd0, 0x8b, 0x45, 0xa0,
+    0xd7, 0x68, 0x42, 0xaf, 0xc7, 0x84, 0x5e, 0xf0, 0x84, 0x5e, 0xf6, 0x1b, 0x53, 0xc6, 0x66, 0x63,
+    0x8a, 0x5e, 0x6c, 0x42, 0x2f, 0xce, 0x40, 0x2f, 0x95, 0x80, 0x5e, 0x1a, 0x01, 0xbd, 0x74, 0x04,
+    0x7a, 0x19, 0x04, 0xf4, 0x32, 0x19, 0xe8, 0xb5, 0x10, 0xd0, 0xab, 0x10, 0xd0, 0xab, 0x22, 0xd0,
+    0xab, 0x11, 0xd0, 0xab, 0x33, 0xd0, 0x6b, 0x25, 0xa0, 0xd7, 0x46, 0x40, 0xaf, 0x1d, 0x81, 0x5e,
+    0x07, 0x01, 0xbd, 0xce, 0x18, 0xf4, 0x1a, 0x4d, 0xe8, 0xf5, 0x98, 0xd0, 0x2b, 0x9e, 0xd0, 0xcb,
+    0x7e, 0x6f, 0xca, 0xd8, 0xec, 0x4d, 0xd1, 0x8b, 0x4d, 0xe8, 0xad, 0x10, 0xd0, 0x9b, 0xa0, 0xdd,
+    0xf3, 0x8a, 0x40, 0x6f, 0x46, 0x40, 0x6f, 0xce, 0x40, 0x6f, 0x95, 0x80, 0xde, 0x1a, 0x01, 0xbd,
+    0x75, 0x04, 0x7a, 0x1b, 0x04, 0xf4, 0x36, 0x19, 0xe8, 0xbd, 0x10, 0xd0, 0xbb, 0x10, 0xd0, 0xbb,
+    0x22, 0xd0, 0xbb, 0x11, 0xd0, 0xbb, 0x33, 0xd0, 0x7b, 0x0d, 0x37, 0xd1, 0x47, 0x13, 0x7a, 0x3d,
+    0x26, 0xf4, 0x8a, 0x27, 0xf4, 0xb2, 0xdf, 0x9a, 0x32, 0x37, 0x5b, 0x53, 0xf4, 0x62, 0x13, 0x7a,
+    0x6f, 0x04, 0xf4, 0xde, 0x11, 0xe8, 0x7d, 0x10, 0xd0, 0xfb, 0x64, 0xa0, 0xaf, 0x05, 0x7d, 0xe9,
+    0x5e, 0x08, 0xe8, 0xab, 0x22, 0xd0, 0x57, 0x23, 0xa0, 0xaf, 0xce, 0x40, 0x5f, 0x2b, 0x01, 0x7d,
+    0x6d, 0x04, 0xf4, 0xb5, 0x23, 0xd0, 0xd7, 0x41, 0x40, 0x5f, 0x27, 0x03, 0x7d, 0x2b, 0x04, 0xf4,
+    0x4d, 0x22, 0xd0, 0x6b, 0x34, 0xa1, 0xd7, 0x63, 0x42, 0xaf, 0x78, 0x42, 0x2f, 0xfb, 0xbd, 0x29,
+    0x73, 0xb3, 0x37, 0x45, 0x2f, 0x36, 0xa1, 0x6f, 0x8a, 0x40, 0xdf, 0x8c, 0x80, 0xbe, 0x39, 0x03,
+    0x7d, 0xab, 0x04, 0xf4, 0xad, 0x11, 0xd0, 0xb7, 0x8e, 0x40, 0xdf, 0x06, 0x1a, 0xd3, 0x4f, 0x38,
+    0xa7, 0x2f, 0x04, 0xf4, 0x5d, 0x08, 0xe8, 0xbb, 0x22, 0xd0, 0x77, 0x23, 0xa0, 0xef, 0xce, 0x40,
+    0xdf, 0x2b, 0x01, 0x7d, 0x6f, 0x04, 0xf4, 0xbd, 0x87, 0xa0, 0xd7, 0x68, 0x54, 0xaf, 0xc7, 0xa8,
+    0x5e, 0xf1, 0xa8, 0x5e, 0xf6, 0xdb, 0x54, 0xee, 0x36, 0xdb, 0x54, 0xf4, 0x62, 0xa3, 0xfa, 0x3e,
+    0x08, 0xe8, 0xfb, 0x64, 0xa0, 0x1f, 0x85, 0x80, 0x7e, 0x20, 0xd1, 0x0f, 0x46, 0xfa, 0x81, 0x4c,
+    0x3f, 0x20, 0xea, 0x07, 0x52, 0xfd, 0x40, 0xac, 0x1f, 0xd0, 0xf5, 0x08, 0xf6, 0x03, 0xca, 0x7e,
+    0x22, 0xd9, 0x4f, 0x24, 0xfb, 0xc9, 0x64, 0x3f, 0x63, 0xd9, 0x47, 0xa3, 0x7a, 0x3d, 0x46, 0xf5,
+    0x8a, 0x47, 0xf5, 0xb2, 0xdf, 0xa6, 0x72, 0xb7, 0xd9, 0xa6, 0xa2, 0x17, 0x1b, 0xd5, 0x4f, 0x28,
+    0xfb, 0x89, 0x64, 0x3f, 0x91, 0xec, 0x27, 0x94, 0x3d, 0x81, 0xbd, 0xc2, 0x41, 0x3d, 0x61, 0xbd,
+    0xa3, 0xef, 0xdd, 0x23, 0xd4, 0x37, 0xb4, 0x85, 0x9e, 0x91, 0x7e, 0x10, 0xd1, 0x4f, 0x02, 0xfa,
+    0xe5, 0x09, 0x59, 0x06, 0x7a, 0x11, 0x02, 0x7a, 0xd1, 0x04, 0xf4, 0xd1, 0x84, 0x5e, 0x8f, 0x09,
+    0xbd, 0xe2, 0x09, 0xbd, 0xec, 0xf7, 0xa7, 0xdc, 0x6d, 0xf6, 0xa7, 0xe8, 0xc5, 0x26, 0xf4, 0x62,
+    0x04, 0xf4, 0xe2, 0x04, 0xf4, 0x52, 0x11, 0xe8, 0xa5, 0x11, 0xd0, 0x4b, 0x67, 0xa0, 0x97, 0x41,
+    0x40, 0x2f, 0x93, 0x80, 0x5e, 0x0b, 0x02, 0xbd, 0x0a, 0x01, 0xbd, 0x2a, 0x03, 0xbd, 0x1a, 0x01,
+    0xbd, 0x3a, 0x01, 0xbd, 0x56, 0x04, 0x7a, 0x6d, 0x04, 0xf4, 0xda, 0x19, 0xe8, 0x75, 0x84, 0xa0,
+    0x8f, 0x26, 0xf4, 0x7a, 0x4c, 0xe8, 0x95, 0x4f, 0xe8, 0xf7, 0xbb, 0x53, 0xee, 0x37, 0xbb, 0x53,
+    0xf4, 0x62, 0x13, 0x7a, 0x9d, 0x04, 0xf4, 0x56, 0x10, 0xe8, 0x4d, 0xd0, 0x1e, 0x7a, 0x65, 0xa0,
+    0x37, 0x23, 0xa0, 0x37, 0x27, 0xa0, 0xb7, 0x8a, 0x40, 0x6f, 0x8d, 0x80, 0xde, 0x3a, 0x03, 0xbd,
+    0x0d, 0x02, 0x7a, 0x9b, 0x04, 0xf4, 0x5e, 0x10, 0xe8, 0x5d, 0x08, 0xe8, 0x5d, 0x19, 0xe8, 0xdd,
+    0x08, 0xe8, 0xdd, 0x43, 0xd0, 0x47, 0x13, 0x7a, 0x3d, 0x26, 0xf4, 0xca, 0x27, 0xf4, 0xfb, 0xdd,
+    0x29, 0xf7, 0x9b, 0xdd, 0x29, 0x7a, 0xb1, 0x09, 0xbd, 0x57, 0x04, 0x7a, 0x6f, 0x04, 0xf4, 0xde,
+    0x19, 0xe8, 0x7d, 0x10, 0xd0, 0xfb, 0x24, 0xa0, 0xaf, 0x85, 0x7d, 0xed, 0x5e, 0x08, 0xe8, 0xab,
+    0x32, 0xd0, 0x57, 0x23, 0xa0, 0xaf, 0x4e, 0x40, 0x5f, 0x2b, 0x02, 0x7d, 0x6d, 0x04, 0xf4, 0xb5,
+    0x33, 0xd0, 0xd7, 0x41, 0x40, 0x5f, 0x27, 0x01, 0x7d, 0x2b, 0x31, 0xe8, 0x67, 0xda, 0x46, 0xac,
+    0x7c, 0x42, 0xbf, 0xdf, 0x9e, 0xf2, 0xe0, 0x17, 0x68, 0x23, 0x8e, 0x1f, 0x7e, 0x09, 0x01, 0x7d,
+    0x53, 0x06, 0xfa, 0x66, 0x04, 0xf4, 0xcd, 0x09, 0xe8, 0x5b, 0x45, 0xa0, 0x6f, 0x8d, 0x80, 0xbe,
+    0x75, 0x06, 0xfa, 0x36, 0xd0, 0x98, 0x7e, 0xa2, 0x39, 0x7d, 0x41, 0xa0, 0xef, 0x42, 0x40, 0xdf,
+    0x95, 0x81, 0xbe, 0x1b, 0x01, 0x7d, 0x77, 0x02, 0xfa, 0x5e, 0x11, 0xe8, 0x7b, 0x8b, 0x40, 0x6f,
+    0x25, 0x2d, 0x26, 0x56, 0x3e, 0xaa, 0xdf, 0x6f, 0x53, 0x79, 0xb8, 0xbf, 0x66, 0x31, 0x71, 0xef,
+    0x0c, 0xf4, 0x7d, 0x10, 0xd0, 0xf7, 0x49, 0x40, 0x3f, 0x0a, 0x02, 0xfd, 0x40, 0xa2, 0x1f, 0x90,
+    0xf4, 0x03, 0x99, 0x7e, 0x20, 0xd4, 0x0f, 0xa6, 0xfa, 0x81, 0x58, 0x3f, 0xa8, 0xeb, 0x11, 0xec,
+    0x07, 0x92, 0xfd, 0x64, 0xb2, 0x9f, 0x48, 0xf6, 0x33, 0x91, 0xbd, 0x49, 0xda, 0x4d, 0x6c, 0x7c,
+    0x54, 0xbf, 0xdf, 0xa8, 0xf2, 0xa8, 0xd7, 0xec, 0x26, 0x9e, 0x48, 0xf6, 0x13, 0xc9, 0x7e, 0x32,
+    0xd9, 0x4f, 0x24, 0xfb, 0x49, 0x65, 0x4f, 0x60, 0xaf, 0x68, 0x50, 0x8f, 0x58, 0xef, 0xe8, 0x7b,
+    0xf7, 0x0c, 0xf5, 0x0d, 0x6d, 0xa3, 0x27, 0xa4, 0x1f, 0xac, 0x12, 0x0f, 0xd5, 0xdc, 0x17, 0x58,
+    0x73, 0x2f, 0x11, 0xe8, 0x4d, 0xd3, 0x4a, 0x62, 0xe3, 0x13, 0xfa, 0xfd, 0xee, 0x94, 0xc7, 0x79,
+    0xcd, 0x4a, 0xe2, 0xe4, 0xa4, 0x81, 0xb2, 0x2d, 0x53, 0x4b, 0x7b, 0xee, 0x9d, 0x80, 0x5e, 0x2a,
+    0x03, 0xbd, 0x34, 0x02, 0xfa, 0xa4, 0xa8, 0xdf, 0xb7, 0x5d, 0x64, 0x19, 0xe8, 0x93, 0xa2, 0xfe,
+    0xb6, 0xad, 0x22, 0xcb, 0x7b, 0xee, 0x05, 0xf5, 0xdc, 0x2b, 0xea, 0xb9, 0x37, 0xd6, 0x73, 0xef,
+    0x04, 0xf4, 0x59, 0x51, 0xff, 0xd9, 0xd3, 0xaf, 0x46, 0x40, 0xff, 0xbe, 0xa8, 0xff, 0x35, 0x2a,
+    0x96, 0x76, 0x12, 0x1b, 0x9e, 0xd0, 0xeb, 0x7e, 0x77, 0xca, 0xa9, 0x5c, 0xb3, 0x93, 0x38, 0x3b,
+    0x6a, 0xa0, 0x6c, 0xcb, 0xd4, 0xb2, 0xa2, 0xfb, 0x02, 0x8b, 0xee, 0x05, 0xed, 0xa2, 0x57, 0x54,
+    0x74, 0x6f, 0xac, 0xe8, 0xde, 0x09, 0xe8, 0xd3, 0xa6, 0xfe, 0xb6, 0x6d, 0x23, 0x4b, 0x40, 0x9f,
+    0x34, 0xf5, 0xf7, 0x6d, 0x19, 0x59, 0x06, 0xfa, 0xa4, 0xa9, 0x7f, 0x6e, 0xbb, 0xc8, 0xf2, 0xa2,
+    0x7b, 0x41, 0x45, 0xf7, 0x8a, 0x8a, 0xee, 0x2d, 0x04, 0xbd, 0x79, 0xda, 0x49, 0x6c, 0x78, 0x42,
+    0xaf, 0xfb, 0xed, 0x29, 0xa7, 0x7e, 0xcd, 0x4e, 0xe2, 0xe4, 0xac, 0x81, 0xb2, 0x6d, 0x53, 0x4b,
+    0x41, 0x1f, 0x9f, 0x35, 0x70, 0xf6, 0xec, 0xab, 0x13, 0xd0, 0xfb, 0x40, 0xa0, 0x4f, 0xaa, 0xfa,
+    0x7d, 0xdb, 0x45, 0x96, 0x7f, 0xed, 0x5e, 0x50, 0xd3, 0xbd, 0xa2, 0xa6, 0x7b, 0x63, 0x4d, 0xf7,
+    0x4e, 0x40, 0x9f, 0x56, 0xf5, 0xcf, 0x6d, 0x1b, 0x59, 0x02, 0xfa, 0xb8, 0xaa, 0xff, 0xec, 0xd9,
+    0xd7, 0x40, 0xa0, 0x7f, 0x5f, 0xd5, 0xff, 0x1a, 0x95, 0x9a, 0x96, 0x12, 0x1b, 0x9e, 0xd0, 0xeb,
+    0x7e, 0x77, 0xca, 0xe9, 0x74, 0xcd, 0x52, 0xe2, 0xf4, 0xb0, 0x81, 0xb2, 0xed, 0x53, 0xcb, 0xaa,
+    0xee, 0x15, 0x55, 0xdd, 0x1b, 0xab, 0xba, 0x77, 0x02, 0xfa, 0xb4, 0xab, 0xdf, 0xb7, 0x6d, 0x64,
+    0x09, 0xe8, 0x93, 0xae, 0xfe, 0xb6, 0x2d, 0x23, 0x4b, 0xc7, 0xf4, 0x13, 0xcd, 0xe9, 0x0b, 0xac,
+    0xba, 0x17, 0x54, 0x75, 0xaf, 0xa8, 0xea, 0xde, 0x58, 0xd5, 0xbd, 0x13, 0xd0, 0xef, 0xba, 0xfa,
+    0x5f, 0xc3, 0xd2, 0xd2, 0x82, 0x62, 0xc3, 0xa3, 0x7a, 0xdd, 0x6f, 0x54, 0x79, 0xaa, 0xd7, 0x2c,
+    0x28, 0x4e, 0x4e, 0x1b, 0x28, 0x51, 0x9d, 0x5a, 0x04, 0xfa, 0xe4, 0xb4, 0x81, 0x35, 0x2b, 0x7d,
+    0xa2, 0xae, 0xfb, 0x02, 0xbb, 0xee, 0x91, 0xe8, 0x07, 0x22, 0xfd, 0x60, 0xa6, 0x1f, 0x08, 0xf5,
+    0x03, 0xaa, 0x7e, 0x20, 0xd6, 0x0f, 0xe6, 0x7a, 0x06, 0xfb, 0x81, 0x64, 0x3f, 0xa1, 0xec, 0x67,
+    0x2c, 0xfb, 0x9e, 0x16, 0x14, 0x1b, 0x1e, 0xd5, 0xeb, 0x7e, 0x9b, 0xca, 0xd3, 0xc3, 0x35, 0x0b,
+    0x8a, 0x27, 0x92, 0xfd, 0x64, 0xb2, 0x9f, 0x48, 0xf6, 0x13, 0xca, 0x7e, 0x22, 0xd9, 0x4f, 0x26,
+    0x7b, 0x76, 0x80, 0x1d, 0x1a, 0xd4, 0x33, 0xd6, 0x3b, 0xfa, 0xde, 0x3d, 0x41, 0x7d, 0x63, 0xdb,
+    0xe8, 0x09, 0xe9, 0x07, 0x6c, 0xc5, 0x43, 0x65, 0xf7, 0x25, 0x04, 0xfd, 0x48, 0x7b, 0x89, 0x0d,
+    0x4f, 0xe8, 0x75, 0xbb, 0x3b, 0x45, 0x8a, 0x5d, 0xb3, 0x97, 0x38, 0x3b, 0x6f, 0xa0, 0x78, 0x05,
+    0xe7, 0x0d, 0xc8, 0xb6, 0x4d, 0x2d, 0x6f, 0xbb, 0x77, 0x02, 0x7a, 0xa9, 0x04, 0xf4, 0x59, 0x5d,
+    0xbf, 0x5b, 0x01, 0x75, 0xfd, 0x75, 0xdb, 0x45, 0x96, 0x82, 0x3e, 0xa9, 0xeb, 0x6f, 0x51, 0x19,
+    0x59, 0xd8, 0x76, 0x2f, 0xac, 0xed, 0x5e, 0x51, 0xdb, 0xbd, 0xc1, 0xb6, 0x7b, 0x27, 0xa0, 0x8f,
+    0xeb, 0xfa, 0xcf, 0x9e, 0x7d, 0xb5, 0x18, 0xf4, 0x33, 0xad, 0x25, 0x36, 0x3c, 0xa1, 0xd7, 0xb6,
+    0xcf, 0xca, 0xdd, 0x35, 0x6b, 0x89, 0x93, 0x03, 0x07, 0xca, 0xb6, 0x4d, 0x2d, 0x05, 0x7d, 0x7c,
+    0xe0, 0xc0, 0xd9, 0xb3, 0xaf, 0x82, 0xea, 0xee, 0x85, 0xed, 0xa2, 0x57, 0x54, 0x77, 0x6f, 0xb0,
+    0xee, 0xde, 0x09, 0xe8, 0x93, 0xbe, 0xfe, 0xb6, 0x2d, 0x23, 0xcb, 0x40, 0x9f, 0xf4, 0xf5, 0x8f,
+    0x6d, 0x17, 0x59, 0x0a, 0xfa, 0xa4, 0xaf, 0x7f, 0x46, 0x65, 0x64, 0x61, 0xdd, 0xbd, 0xb0, 0xba,
+    0x7b, 0x8d, 0x40, 0xef, 0x25, 0xad, 0x25, 0x36, 0x3c, 0xa1, 0xd7, 0xed, 0xee, 0x14, 0x11, 0xb9,
+    0x66, 0x2d, 0x71, 0x7a, 0xe2, 0x40, 0xd9, 0xf6, 0xa9, 0x25, 0xa0, 0x8f, 0x4f, 0x1c, 0x38, 0x7b,
+    0xf6, 0xd5, 0x10, 0xe8, 0xbd, 0x13, 0xd0, 0xa7, 0x7d, 0xfd, 0xbe, 0x6d, 0x23, 0xcb, 0xea, 0xee,
+    0x0b, 0xfa, 0xda, 0xbd, 0xb0, 0xba, 0x7b, 0x45, 0x75, 0xf7, 0x06, 0xeb, 0xee, 0x9d, 0x80, 0x3e,
+    0xe9, 0xeb, 0x9f, 0xdb, 0x32, 0xb2, 0x0c, 0xf4, 0x71, 0x5f, 0xff, 0xd9, 0xb3, 0xaf, 0x11, 0x83,
+    0xde, 0x25, 0x2d, 0x26, 0x76, 0x3c, 0xa1, 0xd7, 0xb1, 0x0f, 0xcb, 0xb8, 0x66, 0x31, 0x71, 0x72,
+    0xe2, 0x40, 0x89, 0xea, 0xd4, 0xc2, 0xba, 0x7b, 0x61, 0x75, 0xf7, 0x8a, 0xea, 0xee, 0x0d, 0xd6,
+    0xdd, 0x3b, 0x01, 0x7d, 0xd2, 0xd7, 0x5f, 0xb7, 0x65, 0x64, 0x19, 0xe8, 0x93, 0xbe, 0xfe, 0xb6,
+    0xed, 0x22, 0xcb, 0xc7, 0xf4, 0x13, 0xcd, 0xe9, 0x0b, 0xaa, 0xbb, 0x17, 0x56, 0x77, 0xaf, 0xa8,
+    0xee, 0xde, 0x60, 0xdd, 0xbd, 0x47, 0xa0, 0x77, 0x4d, 0x0b, 0x8a, 0x1d, 0x8f, 0xea, 0x75, 0xee,
+    0xa3, 0xf2, 0x74, 0xcd, 0x82, 0xe2, 0xe4, 0xc4, 0x81, 0xb2, 0xad, 0x53, 0xcb, 0x40, 0x1f, 0x9f,
+    0x38, 0x70, 0xf6, 0xec, 0x6b, 0x30, 0xd0, 0xf7, 0x89, 0xea, 0xee, 0x0b, 0xaa, 0xbb, 0x67, 0xa2,
+    0x1f, 0x88, 0xf4, 0x03, 0x9a, 0x7e, 0x20, 0xd4, 0x0f, 0xa4, 0xfa, 0xc1, 0x58, 0x3f, 0x98, 0xeb,
+    0x21, 0xec, 0x07, 0x92, 0xfd, 0x0c, 0x65, 0xef, 0x96, 0x16, 0x14, 0x3b, 0x1f, 0xd5, 0x6f, 0xb7,
+    0xa9, 0x88, 0xb6, 0x6b, 0x16, 0x14, 0x4f, 0x26, 0xfb, 0x89, 0x64, 0x3f, 0xa1, 0xec, 0x27, 0x92,
+    0xfd, 0x44, 0xb2, 0x9f, 0x4c, 0xf6, 0x93, 0xc9, 0x1e, 0x1e, 0x63, 0x87, 0x06, 0xf5, 0xe8, 0x40,
+    0x7a, 0xf6, 0xbd, 0x7b, 0x82, 0xfa, 0x06, 0xb7, 0xd1, 0x13, 0xd2, 0x0f, 0xd4, 0x8a, 0x17, 0x1f,
+    0x45, 0xef, 0x69, 0x2d, 0xb1, 0xf3, 0x09, 0xfd, 0xfd, 0x3e, 0x22, 0x8f, 0xd7, 0xac, 0x25, 0x4e,
+    0x4e, 0x1c, 0x28, 0xdb, 0x36, 0xb5, 0xbc, 0xee, 0x5e, 0x51, 0x29, 0x9e, 0xa1, 0xba, 0x7b, 0x47,
+    0xa0, 0x4f, 0xfa, 0xfa, 0x7d, 0xdb, 0x45, 0x96, 0x82, 0x3e, 0xe9, 0xeb, 0x6f, 0x51, 0x19, 0x59,
+    0x04, 0xfa, 0xac, 0xaf, 0xbf, 0x5b, 0x01, 0x7d, 0xfd, 0x63, 0xdb, 0x45, 0x96, 0xd7, 0xdd, 0x2b,
+    0xaa, 0xbb, 0x37, 0x54, 0x77, 0xef, 0x08, 0xf4, 0xef, 0xfb, 0xfa, 0x5f, 0xa3, 0x52, 0xd3, 0x5a,
+    0x62, 0xe7, 0x13, 0xfa, 0xed, 0xee, 0x94, 0x6f, 0xcb, 0xe0, 0x9a, 0xb5, 0xc4, 0xe9, 0x89, 0x03,
+    0x65, 0xdb, 0xa7, 0x96, 0x80, 0x3e, 0x3e, 0x71, 0xe0, 0xec, 0xf0, 0x94, 0xc9, 0xea, 0xee, 0x0b,
+    0xaa, 0xbb, 0x17, 0xb8, 0x8b, 0x5e, 0x51, 0xdd, 0xbd, 0xa1, 0xba, 0x7b, 0x47, 0xa0, 0x4f, 0xfa,
+    0xfa, 0xfb, 0xb6, 0x8b, 0x2c, 0x05, 0x7d, 0xd2, 0xd7, 0x3f, 0xa3, 0x32, 0xb2, 0x08, 0xf4, 0x49,
+    0x5f, 0xff, 0xd9, 0xc3, 0xaf, 0x82, 0xea, 0xee, 0x25, 0x01, 0x7d, 0x4b, 0x8b, 0x89, 0x9d, 0x4f,
+    0xe8, 0x1f, 0xf7, 0x61, 0xb9, 0xbf, 0x66, 0x31, 0x71, 0x72, 0xe2, 0x40, 0x89, 0xea, 0xd4, 0xc2,
+    0xba, 0x7b, 0x47, 0xa0, 0xf7, 0x4a, 0x40, 0xef, 0x8d, 0x81, 0x3e, 0xe9, 0xeb, 0xf7, 0xa8, 0x8c,
+    0x2c, 0x02, 0x7d, 0xd6, 0xd7, 0xdf, 0x4a, 0x01, 0x7d, 0xfd, 0x6d, 0xdb, 0x45, 0x96, 0xd7, 0xdd,
+    0x2b, 0xaa, 0xbb, 0x37, 0x54, 0x77, 0xef, 0x08, 0xf4, 0x71, 0x5f, 0xff, 0xd9, 0xb3, 0xaf, 0xc6,
+    0x40, 0xff, 0xbe, 0xaf, 0xff, 0x35, 0x2a, 0x3d, 0xed, 0x25, 0x76, 0x3e, 0xa1, 0xdf, 0xee, 0x4e,
+    0x11, 0xd7, 0x6b, 0xf6, 0x12, 0x27, 0x27, 0x0e, 0x94, 0x6d, 0x9d, 0x5a, 0x5a, 0x77, 0x5f, 0x50,
+    0xdd, 0xbd, 0xc0, 0xba, 0x7b, 0x45, 0x75, 0xf7, 0x86, 0xea, 0xee, 0x1d, 0x81, 0x3e, 0xe9, 0xeb,
+    0x6f, 0xdb, 0x2e, 0xb2, 0x14, 0xf4, 0x49, 0x5f, 0x7f, 0x8f, 0xca, 0xc8, 0xc2, 0x31, 0xfd, 0x64,
+    0x73, 0xfa, 0x82, 0xea, 0xee, 0x05, 0xd6, 0xdd, 0x2b, 0xaa, 0xbb, 0xb7, 0x10, 0xf4, 0x23, 0x2d,
+    0x28, 0x76, 0x3e, 0xaa, 0x7f, 0xda, 0x47, 0x65, 0x5e, 0xb3, 0xa0, 0x38, 0x3b, 0x71, 0xa0, 0x78,
+    0x05, 0x27, 0x0e, 0xc8, 0xb6, 0x4d, 0x2d, 0x05, 0x7d, 0xef, 0x04, 0xf4, 0x7d, 0x10, 0xd0, 0x67,
+    0x7d, 0xfd, 0x6e, 0x05, 0xf4, 0xf5, 0xd7, 0x6d, 0x17, 0x59, 0x5e, 0x77, 0x8f, 0x48, 0x3f, 0x90,
+    0xe9, 0x07, 0x43, 0xfd, 0x40, 0xaa, 0x1f, 0x90, 0xf5, 0x83, 0xb9, 0x1e, 0xc1, 0x7e, 0xd3, 0xd7,
+    0xff, 0xdb, 0xdf, 0xfe, 0x0b, 0x78, 0x85, 0x49, 0x7d, 0xdb, 0x97, 0x00, 0x00,
+};
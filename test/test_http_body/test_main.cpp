@@ -0,0 +1,382 @@
+#include <unity.h>
+#include <ClientReader.h>
+#include <HttpResponse.h>
+#include <GzipStream.h>
+#include <HttpUrl.h>
+
+#include <string>
+#include <vector>
+
+#include "payloads.h"
+
+// Stands in for WiFiClientSecure: serves a recorded response in pieces of the
+// given sizes (the last size repeats), then closes the connection.
+class FakeClient
+{
+public:
+  FakeClient(const std::string &data, std::vector<size_t> pieces)
+      : data_(data), pieces_(pieces)
+  {
+    pieceLeft_ = nextPiece();
+  }
+
+  int available()
+  {
+    if (pos_ == data_.size())
+      return 0;
+    if (pieceLeft_ == 0)
+      pieceLeft_ = nextPiece();
+    size_t left = data_.size() - pos_;
+    return (int)(pieceLeft_ < left ? pieceLeft_ : left);
+  }
+
+  int read(uint8_t *buf, size_t len)
+  {
+    size_t n = (size_t)available();
+    if (n > len)
+      n = len;
+    memcpy(buf, data_.data() + pos_, n);
+    pos_ += n;
+    pieceLeft_ -= n;
+    return (int)n;
+  }
+
+  uint8_t connected() { return pos_ < data_.size(); }
+
+private:
+  size_t nextPiece()
+  {
+    size_t size = pieces_[pieceIndex_];
+    if (pieceIndex_ + 1 < pieces_.size())
+      pieceIndex_++;
+    return size;
+  }
+
+  std::string data_;
+  std::vector<size_t> pieces_;
+  size_t pieceIndex_ = 0;
+  size_t pieceLeft_ = 0;
+  size_t pos_ = 0;
+};
+
+static const std::vector<size_t> kIrregular = {1, 7, 3, 64, 2, 200, 5, 13, 511, 9};
+
+static std::string bytes(const uint8_t *data, size_t len)
+{
+  return std::string((const char *)data, len);
+}
+
+static std::string head(const char *extra)
+{
+  return std::string("HTTP/1.1 200 OK\r\n"
+                     "Content-Type: application/json; charset=utf-8\r\n") +
+         extra + "\r\n";
+}
+
+static std::string withLength(const std::string &body, const char *encoding)
+{
+  return head((std::string("content-length: ") + std::to_string(body.size()) + "\r\n" +
+               encoding)
+                  .c_str()) +
+         body;
+}
+
+static std::string chunked(const std::string &body, const std::vector<size_t> &sizes)
+{
+  std::string out = head("Transfer-Encoding: chunked\r\nContent-Encoding: gzip\r\n");
+  size_t pos = 0;
+  for (size_t i = 0; pos < body.size(); i++)
+  {
+    size_t n = sizes[i % sizes.size()];
+    if (n > body.size() - pos)
+      n = body.size() - pos;
+    char size[16];
+    snprintf(size, sizeof(size), "%zx", n);
+    out += std::string(size) + (i == 1 ? ";ext=1" : "") + "\r\n" + body.substr(pos, n) + "\r\n";
+    pos += n;
+  }
+  return out + "0\r\n\r\n";
+}
+
+struct Result
+{
+  bool headOk;
+  int status;
+  bool begun;
+  std::string body;
+  bool finished;
+  size_t compressed;
+  size_t inflated;
+};
+
+// What getSupabaseJson() does, with the parser swapped for readBytes().
+static Result fetch(const std::string &response, const std::vector<size_t> &pieces)
+{
+  FakeClient client(response, pieces);
+  ClientReader<FakeClient> socket(client, 1000);
+  HttpResponse http(socket);
+
+  Result result = {};
+  result.headOk = http.readHead();
+  if (!result.headOk)
+    return result;
+  result.status = http.statusCode();
+
+  GzipStream body(http, http.gzip());
+  result.begun = body.begin();
+  if (result.begun)
+  {
+    char buf[300];
+    size_t n;
+    while ((n = body.readBytes(buf, sizeof(buf))) > 0)
+      result.body.append(buf, n);
+  }
+  result.finished = body.finish();
+  result.compressed = body.compressedBytes();
+  result.inflated = body.inflatedBytes();
+  return result;
+}
+
+static void assertFetched(const Result &result, const char *json, size_t gzLen)
+{
+  TEST_ASSERT_TRUE(result.headOk);
+  TEST_ASSERT_EQUAL(200, result.status);
+  TEST_ASSERT_TRUE(result.begun);
+  TEST_ASSERT_TRUE(result.finished);
+  TEST_ASSERT_EQUAL(strlen(json), result.body.size());
+  TEST_ASSERT_TRUE(result.body == json);
+  TEST_ASSERT_EQUAL(gzLen, result.compressed);
+  TEST_ASSERT_EQUAL(strlen(json), result.inflated);
+}
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_recorded_payloads_in_irregular_pieces(void)
+{
+  assertFetched(fetch(withLength(bytes(kPlansGz, sizeof(kPlansGz)), "Content-Encoding: gzip\r\n"),
+                      kIrregular),
+                kPlansJson, sizeof(kPlansGz));
+  assertFetched(fetch(withLength(bytes(kUsersGz, sizeof(kUsersGz)), "Content-Encoding: gzip\r\n"),
+                      kIrregular),
+                kUsersJson, sizeof(kUsersGz));
+  assertFetched(fetch(withLength(bytes(kEventGz, sizeof(kEventGz)), "Content-Encoding: gzip\r\n"),
+                      kIrregular),
+                kEventJson, sizeof(kEventGz));
+}
+
+void test_one_byte_pieces(void)
+{
+  assertFetched(fetch(withLength(bytes(kPlansGz, sizeof(kPlansGz)), "Content-Encoding: gzip\r\n"),
+                      {1}),
+                kPlansJson, sizeof(kPlansGz));
+}
+
+void test_input_boundary_inside_gzip_header(void)
+{
+  // The first piece ends k bytes into the body, so GzipStream's first input
+  // buffer stops at every offset of the 10-byte header and just past it.
+  std::string gz = bytes(kUsersGz, sizeof(kUsersGz));
+  for (size_t k = 1; k <= 12; k++)
+  {
+    std::string response = withLength(gz, "Content-Encoding: gzip\r\n");
+    size_t headLen = response.size() - gz.size();
+    assertFetched(fetch(response, {headLen + k, 3, 64}), kUsersJson, gz.size());
+  }
+}
+
+void test_fextra_fname_fcomment_fhcrc_header(void)
+{
+  // kEventGz sets every optional header field; cut inside each of them too.
+  std::string gz = bytes(kEventGz, sizeof(kEventGz));
+  std::string response = withLength(gz, "Content-Encoding: gzip\r\n");
+  size_t headLen = response.size() - gz.size();
+  for (size_t k = 10; k <= 60; k += 5)
+    assertFetched(fetch(response, {headLen + k, 2}), kEventJson, gz.size());
+}
+
+void test_output_larger_than_window(void)
+{
+  TEST_ASSERT_TRUE(kPlansLargeJsonLength > TINFL_LZ_DICT_SIZE);
+
+  Result result = fetch(withLength(bytes(kPlansLargeGz, sizeof(kPlansLargeGz)),
+                                   "Content-Encoding: gzip\r\n"),
+                        kIrregular);
+  TEST_ASSERT_TRUE(result.finished);
+  TEST_ASSERT_EQUAL(kPlansLargeJsonLength, result.body.size());
+  TEST_ASSERT_EQUAL(kPlansLargeJsonLength, result.inflated);
+  TEST_ASSERT_EQUAL(sizeof(kPlansLargeGz), result.compressed);
+  uint32_t crc = (uint32_t)mz_crc32(0, (const uint8_t *)result.body.data(), result.body.size());
+  TEST_ASSERT_EQUAL(kPlansLargeJsonCrc, crc);
+}
+
+void test_chunked_transfer_encoding(void)
+{
+  std::string gz = bytes(kPlansLargeGz, sizeof(kPlansLargeGz));
+  Result result = fetch(chunked(gz, {100, 1, 4096, 37}), kIrregular);
+  TEST_ASSERT_TRUE(result.finished);
+  TEST_ASSERT_EQUAL(kPlansLargeJsonLength, result.inflated);
+  TEST_ASSERT_EQUAL(gz.size(), result.compressed);
+
+  assertFetched(fetch(chunked(bytes(kPlansGz, sizeof(kPlansGz)), {7, 300}), {5, 40}),
+                kPlansJson, sizeof(kPlansGz));
+}
+
+void test_no_content_length(void)
+{
+  // Without Content-Length or chunking the body runs until the server closes.
+  std::string gz = bytes(kPlansGz, sizeof(kPlansGz));
+  assertFetched(fetch(head("Content-Encoding: gzip\r\n") + gz, kIrregular), kPlansJson, gz.size());
+}
+
+void test_truncated_body(void)
+{
+  std::string gz = bytes(kPlansGz, sizeof(kPlansGz));
+  std::string full = withLength(gz, "Content-Encoding: gzip\r\n");
+
+  // Connection drops mid-deflate, with and without a Content-Length.
+  Result cut = fetch(full.substr(0, full.size() - gz.size() / 2), kIrregular);
+  TEST_ASSERT_FALSE(cut.finished);
+  Result cutNoLength = fetch(head("Content-Encoding: gzip\r\n") + gz.substr(0, gz.size() / 2), kIrregular);
+  TEST_ASSERT_FALSE(cutNoLength.finished);
+
+  // Only the trailer is missing: every JSON byte arrived, but it can't be verified.
+  Result noTrailer = fetch(head("Content-Encoding: gzip\r\n") + gz.substr(0, gz.size() - 8), kIrregular);
+  TEST_ASSERT_TRUE(noTrailer.body == kPlansJson);
+  TEST_ASSERT_FALSE(noTrailer.finished);
+
+  // Chunked body that stops inside a chunk.
+  std::string chunks = chunked(gz, {100});
+  TEST_ASSERT_FALSE(fetch(chunks.substr(0, chunks.size() - 50), kIrregular).finished);
+}
+
+void test_corrupt_deflate_data(void)
+{
+  std::string gz = bytes(kPlansGz, sizeof(kPlansGz));
+  for (size_t at = 20; at < gz.size() - 8; at += 37)
+  {
+    std::string bad = gz;
+    bad[at] ^= 0x55;
+    Result result = fetch(withLength(bad, "Content-Encoding: gzip\r\n"), kIrregular);
+    TEST_ASSERT_FALSE(result.finished);
+  }
+}
+
+void test_corrupt_trailer(void)
+{
+  std::string gz = bytes(kUsersGz, sizeof(kUsersGz));
+
+  std::string badCrc = gz;
+  badCrc[gz.size() - 8] ^= 0x01;
+  Result result = fetch(withLength(badCrc, "Content-Encoding: gzip\r\n"), kIrregular);
+  TEST_ASSERT_TRUE(result.body == kUsersJson);
+  TEST_ASSERT_FALSE(result.finished);
+
+  std::string badSize = gz;
+  badSize[gz.size() - 4] ^= 0x01;
+  TEST_ASSERT_FALSE(fetch(withLength(badSize, "Content-Encoding: gzip\r\n"), kIrregular).finished);
+}
+
+void test_not_gzip(void)
+{
+  std::string notGzip = "{\"first_name\":\"Jimothy\"}";
+  TEST_ASSERT_FALSE(fetch(withLength(notGzip, "Content-Encoding: gzip\r\n"), kIrregular).begun);
+}
+
+void test_identity_body_is_counted(void)
+{
+  Result result = fetch(withLength(kPlansJson, ""), kIrregular);
+  TEST_ASSERT_TRUE(result.finished);
+  TEST_ASSERT_TRUE(result.body == kPlansJson);
+  TEST_ASSERT_EQUAL(strlen(kPlansJson), result.compressed);
+  TEST_ASSERT_EQUAL(strlen(kPlansJson), result.inflated);
+
+  Result cut = fetch(withLength(kPlansJson, "").substr(0, 200), kIrregular);
+  TEST_ASSERT_FALSE(cut.finished);
+}
+
+void test_status_and_headers(void)
+{
+  FakeClient client("HTTP/1.1 401 Unauthorized\r\n"
+                    "CONTENT-ENCODING: GZIP\r\n"
+                    "transfer-encoding: gzip, chunked\r\n"
+                    "X-Long: " + std::string(300, 'x') + "\r\n"
+                    "\r\n",
+                    {16});
+  ClientReader<FakeClient> socket(client, 1000);
+  HttpResponse http(socket);
+  TEST_ASSERT_TRUE(http.readHead());
+  TEST_ASSERT_EQUAL(401, http.statusCode());
+  TEST_ASSERT_TRUE(http.gzip());
+  TEST_ASSERT_TRUE(http.chunked());
+  TEST_ASSERT_EQUAL(-1, http.contentLength());
+
+  FakeClient cut("HTTP/1.1 200 OK\r\nContent-Le", {16});
+  ClientReader<FakeClient> cutSocket(cut, 1000);
+  HttpResponse cutHttp(cutSocket);
+  TEST_ASSERT_FALSE(cutHttp.readHead());
+}
+
+static std::string target(const char *url, const HttpUrl &parts)
+{
+  return std::string(url + parts.targetStart, url + parts.targetEnd);
+}
+
+void test_parses_urls(void)
+{
+  HttpUrl parts;
+
+  const char *rest = "https://abcd.supabase.co/rest/v1/plans?select=*&current_plan=eq.true";
+  TEST_ASSERT_TRUE(parseHttpUrl(rest, parts));
+  TEST_ASSERT_TRUE(parts.secure);
+  TEST_ASSERT_EQUAL_STRING("abcd.supabase.co", parts.host);
+  TEST_ASSERT_EQUAL(443, parts.port);
+  TEST_ASSERT_TRUE(target(rest, parts) == "/rest/v1/plans?select=*&current_plan=eq.true");
+
+  const char *local = "HTTP://192.168.1.20:54321?id=eq.1#top";
+  TEST_ASSERT_TRUE(parseHttpUrl(local, parts));
+  TEST_ASSERT_FALSE(parts.secure);
+  TEST_ASSERT_EQUAL_STRING("192.168.1.20", parts.host);
+  TEST_ASSERT_EQUAL(54321, parts.port);
+  TEST_ASSERT_TRUE(target(local, parts) == "?id=eq.1");
+
+  const char *bare = "http://example.com";
+  TEST_ASSERT_TRUE(parseHttpUrl(bare, parts));
+  TEST_ASSERT_EQUAL(80, parts.port);
+  TEST_ASSERT_TRUE(target(bare, parts).empty());
+
+  TEST_ASSERT_FALSE(parseHttpUrl("abcd.supabase.co/rest/v1/plans", parts));
+  TEST_ASSERT_FALSE(parseHttpUrl("ftp://example.com/", parts));
+  TEST_ASSERT_FALSE(parseHttpUrl("https:///rest/v1/plans", parts));
+  TEST_ASSERT_FALSE(parseHttpUrl("https://user:pw@example.com/", parts));
+  TEST_ASSERT_FALSE(parseHttpUrl("https://example.com:/", parts));
+  TEST_ASSERT_FALSE(parseHttpUrl("https://example.com:0/", parts));
+  TEST_ASSERT_FALSE(parseHttpUrl("https://example.com:65536/", parts));
+  TEST_ASSERT_FALSE(parseHttpUrl("https://example.com:44a/", parts));
+  TEST_ASSERT_FALSE(parseHttpUrl(("https://" + std::string(HttpUrl::kHostSize, 'a') + "/").c_str(), parts));
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_recorded_payloads_in_irregular_pieces);
+  RUN_TEST(test_one_byte_pieces);
+  RUN_TEST(test_input_boundary_inside_gzip_header);
+  RUN_TEST(test_fextra_fname_fcomment_fhcrc_header);
+  RUN_TEST(test_output_larger_than_window);
+  RUN_TEST(test_chunked_transfer_encoding);
+  RUN_TEST(test_no_content_length);
+  RUN_TEST(test_truncated_body);
+  RUN_TEST(test_corrupt_deflate_data);
+  RUN_TEST(test_corrupt_trailer);
+  RUN_TEST(test_not_gzip);
+  RUN_TEST(test_identity_body_is_counted);
+  RUN_TEST(test_status_and_headers);
+  RUN_TEST(test_parses_urls);
+  return UNITY_END();
+}
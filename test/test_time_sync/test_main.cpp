@@ -0,0 +1,358 @@
+#include <unity.h>
+#include <TimeSync.h>
+
+// A watch clock that runs slow by a fixed ppm against true time, with an NTP
+// stand-in that answers after a short delay with optional jitter.
+class SimPlatform : public SyncPlatform
+{
+public:
+  int64_t trueUs = 1700000000LL * 1000000LL;
+  double ppm = 0.0;
+
+  bool network = true;
+  bool ntpAnswers = true;
+  int64_t ntpLatencyUs = 200000;
+  int64_t ntpJitterUs = 0;
+
+  int starts = 0;
+  int stops = 0;
+
+  // The RTC powers up at the epoch, like the real one.
+  void begin()
+  {
+    clockBaseLocal_ = 0;
+    clockBaseTrue_ = trueUs;
+    bootTrue_ = trueUs;
+  }
+
+  void advance(int64_t us) { trueUs += us; }
+
+  // Jumps the local clock without a sync, like an RTC reset would.
+  void stepClock(int64_t us) { clockBaseLocal_ += us; }
+
+  // Deep sleep: the clock keeps running, but off by sleepPpm instead of ppm,
+  // and the boot timer starts over on wake.
+  void sleep(int64_t us, double sleepPpm)
+  {
+    int64_t clockBefore = clockUs();
+    trueUs += us;
+    clockBaseLocal_ = clockBefore + us - (int64_t)(us * sleepPpm * 1e-6);
+    clockBaseTrue_ = trueUs;
+    bootTrue_ = trueUs;
+    ntpActive_ = false;
+  }
+
+  int64_t clockUs() override { return clockBaseLocal_ + local(trueUs - clockBaseTrue_); }
+
+  void setClockUs(int64_t us) override
+  {
+    clockBaseLocal_ = us;
+    clockBaseTrue_ = trueUs;
+  }
+
+  int64_t timerUs() override { return local(trueUs - bootTrue_); }
+
+  bool networkUp() override { return network; }
+
+  void startNtp() override
+  {
+    starts++;
+    ntpActive_ = true;
+    answerAtUs_ = trueUs + ntpLatencyUs;
+  }
+
+  void stopNtp() override
+  {
+    stops++;
+    ntpActive_ = false;
+  }
+
+  bool takeNtpReply(NtpReply &reply) override
+  {
+    if (!ntpActive_ || !ntpAnswers || trueUs < answerAtUs_)
+      return false;
+    ntpActive_ = false;
+    reply.serverUs = trueUs + nextJitter();
+    reply.clockUs = clockUs();
+    reply.timerUs = timerUs();
+    return true;
+  }
+
+private:
+  int64_t local(int64_t trueElapsedUs) const
+  {
+    return trueElapsedUs - (int64_t)(trueElapsedUs * ppm * 1e-6);
+  }
+
+  // Deterministic, roughly uniform in [-ntpJitterUs, ntpJitterUs].
+  int64_t nextJitter()
+  {
+    if (ntpJitterUs == 0)
+      return 0;
+    seed_ = seed_ * 1103515245u + 12345u;
+    return (int64_t)((seed_ >> 8) % (2 * ntpJitterUs + 1)) - ntpJitterUs;
+  }
+
+  int64_t clockBaseLocal_ = 0;
+  int64_t clockBaseTrue_ = 0;
+  int64_t bootTrue_ = 0;
+  bool ntpActive_ = false;
+  int64_t answerAtUs_ = 0;
+  uint32_t seed_ = 1;
+};
+
+static SimPlatform sim;
+static SyncState state;
+
+// Runs the loop for the given time in one-second steps. Records the largest
+// error of the corrected clock and the spacing of completed syncs.
+struct RunStats
+{
+  int64_t maxErrorUs;
+  int syncs;
+  int64_t intervalsSec[64];
+};
+
+static RunStats run(TimeSync &sync, int64_t seconds)
+{
+  RunStats stats = {};
+  int64_t lastSyncTrueUs = 0;
+  for (int64_t i = 0; i < seconds; i++)
+  {
+    sim.advance(1000000);
+    SyncEvent event = sync.update();
+    if (event == SYNC_DONE)
+    {
+      if (lastSyncTrueUs != 0 && stats.syncs <= 64)
+        stats.intervalsSec[stats.syncs - 1] = (sim.trueUs - lastSyncTrueUs) / 1000000;
+      lastSyncTrueUs = sim.trueUs;
+      stats.syncs++;
+    }
+    if (sync.isSynced())
+    {
+      int64_t errorUs = sync.nowUs() - sim.trueUs;
+      if (errorUs < 0)
+        errorUs = -errorUs;
+      if (errorUs > stats.maxErrorUs)
+        stats.maxErrorUs = errorUs;
+    }
+  }
+  return stats;
+}
+
+void setUp(void)
+{
+  sim = SimPlatform();
+  sim.begin();
+  state = SyncState();
+}
+
+void tearDown(void)
+{
+}
+
+void test_first_sync_sets_clock(void)
+{
+  TimeSync sync(sim, state);
+  TEST_ASSERT_FALSE(sync.isSynced());
+  TEST_ASSERT_EQUAL(0, sync.nowUs());
+
+  TEST_ASSERT_EQUAL(SYNC_STARTED, sync.update());
+  TEST_ASSERT_EQUAL(1, sim.starts);
+
+  sim.advance(500000);
+  TEST_ASSERT_EQUAL(SYNC_DONE, sync.update());
+  TEST_ASSERT_EQUAL(1, sim.stops);
+  TEST_ASSERT_TRUE(sync.isSynced());
+  TEST_ASSERT_INT64_WITHIN(1000, sim.trueUs, sync.nowUs());
+}
+
+void test_no_sync_without_network(void)
+{
+  sim.network = false;
+  TimeSync sync(sim, state);
+  run(sync, 600);
+  TEST_ASSERT_EQUAL(0, sim.starts);
+  TEST_ASSERT_FALSE(sync.isSynced());
+}
+
+void test_converges_on_known_drift(void)
+{
+  sim.ppm = 37.0;
+  sim.ntpJitterUs = 20000;
+  TimeSync sync(sim, state);
+
+  RunStats stats = run(sync, 10 * 24 * 3600);
+
+  TEST_ASSERT_TRUE(stats.syncs >= 4);
+  TEST_ASSERT_FLOAT_WITHIN(1.0, 37.0, state.driftPpm);
+  // The corrected clock stays inside the resync threshold, give or take one
+  // NTP reply's jitter.
+  TEST_ASSERT_TRUE(stats.maxErrorUs < 500000 + 20000);
+}
+
+void test_reading_after_resync_is_corrected_once(void)
+{
+  sim.ppm = 100.0;
+  TimeSync sync(sim, state);
+  run(sync, 2 * 3600);
+  TEST_ASSERT_TRUE(state.syncCount > 0);
+
+  // Walk up to the next sync and look at the clock around it.
+  while (sync.update() != SYNC_STARTED)
+    sim.advance(1000000);
+  sim.advance(1000000);
+  // The reply is in but not yet applied: the old correction still holds.
+  TEST_ASSERT_INT64_WITHIN(100000, sim.trueUs, sync.nowUs());
+  TEST_ASSERT_EQUAL(SYNC_DONE, sync.update());
+  TEST_ASSERT_INT64_WITHIN(1000, sim.trueUs, sync.nowUs());
+}
+
+void test_resync_interval_grows_to_daily(void)
+{
+  sim.ppm = 20.0;
+  TimeSync sync(sim, state);
+
+  RunStats stats = run(sync, 20 * 24 * 3600);
+
+  int intervals = stats.syncs - 1;
+  TEST_ASSERT_TRUE(intervals >= 4);
+  TEST_ASSERT_TRUE(stats.intervalsSec[0] >= 15 * 60);
+  for (int i = 1; i < intervals; i++)
+    TEST_ASSERT_TRUE(stats.intervalsSec[i] + 1 >= stats.intervalsSec[i - 1]);
+  // Measured in true time: the slow local clock and the reply latency add a
+  // few seconds.
+  TEST_ASSERT_INT_WITHIN(5, 24 * 3600, stats.intervalsSec[intervals - 1]);
+}
+
+void test_resync_interval_is_clamped(void)
+{
+  TimeSync sync(sim, state);
+  state.valid = true;
+  state.lastSyncUs = sim.clockUs();
+
+  state.uncertaintyPpm = 4000.0;
+  TEST_ASSERT_EQUAL(15 * 60, sync.secondsUntilResync());
+
+  state.uncertaintyPpm = 2.0;
+  TEST_ASSERT_EQUAL(24 * 3600, sync.secondsUntilResync());
+}
+
+void test_clock_step_is_not_drift(void)
+{
+  sim.ppm = 10.0;
+  TimeSync sync(sim, state);
+  run(sync, 2 * 3600);
+  TEST_ASSERT_TRUE(state.syncCount > 0);
+  TEST_ASSERT_FLOAT_WITHIN(1.0, 10.0, state.driftPpm);
+
+  // An hour-long jump is far beyond the 5000 ppm a crystal could drift.
+  sim.stepClock(-3600LL * 1000000LL);
+  sim.advance(3600LL * 1000000LL);
+  while (sync.update() != SYNC_STARTED)
+    sim.advance(1000000);
+  sim.advance(1000000);
+
+  TEST_ASSERT_EQUAL(SYNC_CLOCK_STEPPED, sync.update());
+  TEST_ASSERT_EQUAL(0, state.syncCount);
+  TEST_ASSERT_FLOAT_WITHIN(0.001, 0.0, state.driftPpm);
+  TEST_ASSERT_FLOAT_WITHIN(0.001, 200.0, state.uncertaintyPpm);
+  TEST_ASSERT_INT64_WITHIN(1000, sim.trueUs, sync.nowUs());
+}
+
+void test_clock_stepped_back_resyncs(void)
+{
+  sim.ppm = 10.0;
+  TimeSync sync(sim, state);
+  run(sync, 2 * 3600);
+  TEST_ASSERT_TRUE(state.syncCount > 0);
+  TEST_ASSERT_TRUE(sync.secondsUntilResync() > 0);
+  int starts = sim.starts;
+
+  // The RTC is reset back to the epoch: the time is no longer known, and a
+  // resync is due right away.
+  sim.stepClock(-sim.clockUs());
+  TEST_ASSERT_FALSE(sync.isSynced());
+  TEST_ASSERT_EQUAL(0, sync.nowUs());
+  TEST_ASSERT_EQUAL(0, sync.secondsUntilResync());
+
+  sim.advance(1000000);
+  TEST_ASSERT_EQUAL(SYNC_STARTED, sync.update());
+  TEST_ASSERT_EQUAL(starts + 1, sim.starts);
+  sim.advance(1000000);
+  TEST_ASSERT_EQUAL(SYNC_CLOCK_STEPPED, sync.update());
+  TEST_ASSERT_TRUE(sync.isSynced());
+  TEST_ASSERT_EQUAL(0, state.syncCount);
+  TEST_ASSERT_INT64_WITHIN(1000, sim.trueUs, sync.nowUs());
+}
+
+void test_deep_sleep_resyncs_without_drift_sample(void)
+{
+  sim.ppm = 20.0;
+  {
+    TimeSync awake(sim, state);
+    run(awake, 3 * 24 * 3600);
+  }
+  TEST_ASSERT_TRUE(state.syncCount > 0);
+  double driftPpm = state.driftPpm;
+  uint32_t syncCount = state.syncCount;
+
+  // Eight hours on an RC slow clock running 2% fast: minutes off, far past
+  // anything the crystal could drift.
+  sim.sleep(8LL * 3600 * 1000000LL, -20000.0);
+  TimeSync sync(sim, state);
+  sync.wokeFromSleep();
+  TEST_ASSERT_TRUE(sync.isSynced());
+  TEST_ASSERT_EQUAL(0, sync.secondsUntilResync());
+
+  TEST_ASSERT_EQUAL(SYNC_STARTED, sync.update());
+  sim.advance(1000000);
+  TEST_ASSERT_EQUAL(SYNC_DONE, sync.update());
+  TEST_ASSERT_INT64_WITHIN(1000, sim.trueUs, sync.nowUs());
+  TEST_ASSERT_EQUAL(syncCount, state.syncCount);
+  TEST_ASSERT_FLOAT_WITHIN(0.001, driftPpm, state.driftPpm);
+  TEST_ASSERT_TRUE(sync.secondsUntilResync() >= 15 * 60 - 1);
+}
+
+void test_timeout_then_retry(void)
+{
+  sim.ntpAnswers = false;
+  TimeSync sync(sim, state);
+
+  TEST_ASSERT_EQUAL(SYNC_STARTED, sync.update());
+  sim.advance(29LL * 1000000LL);
+  TEST_ASSERT_EQUAL(SYNC_NONE, sync.update());
+  sim.advance(2LL * 1000000LL);
+  TEST_ASSERT_EQUAL(SYNC_TIMED_OUT, sync.update());
+  TEST_ASSERT_EQUAL(1, sim.stops);
+
+  // No new attempt until the retry delay has passed.
+  sim.advance(58LL * 1000000LL);
+  TEST_ASSERT_EQUAL(SYNC_NONE, sync.update());
+  TEST_ASSERT_EQUAL(1, sim.starts);
+  sim.advance(3LL * 1000000LL);
+  TEST_ASSERT_EQUAL(SYNC_STARTED, sync.update());
+  TEST_ASSERT_EQUAL(2, sim.starts);
+
+  // The stand-in comes back and the retry succeeds.
+  sim.ntpAnswers = true;
+  sim.advance(1000000);
+  TEST_ASSERT_EQUAL(SYNC_DONE, sync.update());
+  TEST_ASSERT_TRUE(sync.isSynced());
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_first_sync_sets_clock);
+  RUN_TEST(test_no_sync_without_network);
+  RUN_TEST(test_converges_on_known_drift);
+  RUN_TEST(test_reading_after_resync_is_corrected_once);
+  RUN_TEST(test_resync_interval_grows_to_daily);
+  RUN_TEST(test_resync_interval_is_clamped);
+  RUN_TEST(test_clock_step_is_not_drift);
+  RUN_TEST(test_clock_stepped_back_resyncs);
+  RUN_TEST(test_deep_sleep_resyncs_without_drift_sample);
+  RUN_TEST(test_timeout_then_retry);
+  return UNITY_END();
+}